@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+
+import druid.core.Engine;
+
+using druid::core::Engine;
+
+namespace
+{
+	/// @brief One full engine frame: construction, a single loop pass, teardown.
+	auto engine_frame(benchmark::State& state) -> void
+	{
+		for (auto _ : state)
+		{
+			Engine engine;
+			engine.on_update([&engine](auto /*delta*/) { engine.quit(); });
+			benchmark::DoNotOptimize(engine.run());
+		}
+	}
+
+	/// @brief Loop overhead per frame with a warm engine.
+	auto engine_frames(benchmark::State& state) -> void
+	{
+		constexpr auto FramesPerIteration = 1000;
+
+		for (auto _ : state)
+		{
+			Engine engine;
+			auto frames = 0;
+			engine.on_update(
+				[&engine, &frames](auto /*delta*/)
+				{
+					frames++;
+
+					if (frames == FramesPerIteration)
+					{
+						engine.quit();
+					}
+				});
+			benchmark::DoNotOptimize(engine.run());
+		}
+
+		state.SetItemsProcessed(state.iterations() * FramesPerIteration);
+	}
+
+	BENCHMARK(engine_frame);
+	BENCHMARK(engine_frames);
+}
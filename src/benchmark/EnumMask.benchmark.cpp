@@ -0,0 +1,35 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+import druid.core.enummask;
+
+using druid::core::EnumMask;
+
+namespace
+{
+	enum class Flag : std::uint32_t
+	{
+		A = 0x1,
+		B = 0x2,
+		C = 0x4,
+		D = 0x8
+	};
+
+	/// @brief Set/test/remove round trip on a flag mask.
+	auto enummask_operations(benchmark::State& state) -> void
+	{
+		EnumMask<Flag> mask{{Flag::A, Flag::C}};
+
+		for (auto _ : state)
+		{
+			mask.set(Flag::B);
+			mask.flip(Flag::D);
+			benchmark::DoNotOptimize(mask.test(Flag::C));
+			mask.remove(Flag::B);
+			benchmark::DoNotOptimize(mask.get());
+		}
+	}
+
+	BENCHMARK(enummask_operations);
+}
@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+import druid.graphics.Node;
+
+using druid::graphics::Node;
+
+namespace
+{
+	// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+	/// @brief Invalidation storm: dirty the root, re-evaluate a deep leaf.
+	auto node_transform_invalidation(benchmark::State& state) -> void
+	{
+		auto root = std::make_unique<Node>();
+		auto* leaf = root.get();
+
+		for (auto i = 0; i < state.range(0); i++)
+		{
+			leaf = &leaf->create_node();
+		}
+
+		auto offset = 0.0F;
+
+		for (auto _ : state)
+		{
+			offset += 1.0F;
+			root->set_position({offset, offset});
+			benchmark::DoNotOptimize(leaf->transform_global());
+		}
+	}
+
+	/// @brief Batch propagation over a wide dirty tree via the flattened cache.
+	auto node_propagate_transforms(benchmark::State& state) -> void
+	{
+		auto root = std::make_unique<Node>();
+
+		for (auto i = 0; i < state.range(0); i++)
+		{
+			auto& child = root->create_node();
+			(void)child.create_node();
+		}
+
+		auto offset = 0.0F;
+
+		for (auto _ : state)
+		{
+			offset += 1.0F;
+			root->set_position({offset, offset});
+			root->propagate_transforms();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+	}
+
+	BENCHMARK(node_transform_invalidation)->Arg(16)->Arg(256);
+	BENCHMARK(node_propagate_transforms)->Arg(256)->Arg(4096);
+
+	// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+}
@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+
+import druid.core.Engine;
+import druid.core.Object;
+
+using druid::core::Engine;
+using druid::core::Object;
+
+namespace
+{
+	// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+	/// @brief Child creation cost at various tree widths.
+	auto object_create_child(benchmark::State& state) -> void
+	{
+		Engine engine;
+
+		for (auto _ : state)
+		{
+			auto root = std::make_unique<Object>(engine);
+
+			for (auto i = 0; i < state.range(0); i++)
+			{
+				(void)root->create_child();
+			}
+
+			benchmark::DoNotOptimize(root);
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	/// @brief Name lookup cost at various tree widths.
+	auto object_find_child(benchmark::State& state) -> void
+	{
+		Engine engine;
+		auto root = std::make_unique<Object>(engine);
+
+		for (auto i = 0; i < state.range(0); i++)
+		{
+			(void)root->create_child("child-" + std::to_string(i));
+		}
+
+		const auto target = "child-" + std::to_string(state.range(0) / 2);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(root->find_child(target));
+		}
+	}
+
+	BENCHMARK(object_create_child)->Arg(16)->Arg(256)->Arg(4096);
+	BENCHMARK(object_find_child)->Arg(16)->Arg(256)->Arg(4096);
+
+	// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+}
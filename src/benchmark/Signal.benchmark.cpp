@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+import druid.core.Signal;
+
+using druid::core::Signal;
+
+namespace
+{
+	// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+	/// @brief Baseline: a direct call through a lambda.
+	auto raw_call(benchmark::State& state) -> void
+	{
+		auto sum = 0;
+		auto callback = [&sum](int x) { sum += x; };
+
+		for (auto _ : state)
+		{
+			callback(1);
+		}
+
+		benchmark::DoNotOptimize(sum);
+	}
+
+	/// @brief Emission through a connected signal with one subscriber.
+	auto signal_emission(benchmark::State& state) -> void
+	{
+		Signal<void(int)> signal;
+		auto sum = 0;
+		signal.connect([&sum](int x) { sum += x; });
+
+		for (auto _ : state)
+		{
+			signal(1);
+		}
+
+		benchmark::DoNotOptimize(sum);
+	}
+
+	/// @brief Emission cost as the subscriber count grows.
+	auto signal_emission_multicast(benchmark::State& state) -> void
+	{
+		Signal<void(int)> signal;
+		auto sum = 0;
+
+		for (auto i = 0; i < state.range(0); i++)
+		{
+			signal.connect([&sum](int x) { sum += x; });
+		}
+
+		for (auto _ : state)
+		{
+			signal(1);
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+		benchmark::DoNotOptimize(sum);
+	}
+
+	BENCHMARK(raw_call);
+	BENCHMARK(signal_emission);
+	BENCHMARK(signal_emission_multicast)->Arg(4)->Arg(64);
+
+	// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+}
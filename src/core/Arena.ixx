@@ -0,0 +1,120 @@
+module;
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+export module druid.core.Arena;
+
+export namespace druid::core
+{
+	/// @class Arena
+	/// @brief Slab-based bump allocator for hierarchies with a shared lifetime.
+	///
+	/// `Arena` hands out memory by bumping a pointer through large contiguous
+	/// slabs. Individual allocations are never freed; the slabs are released
+	/// wholesale when the arena is destroyed (or `reset`). Allocating a tree
+	/// of thousands of objects therefore costs a handful of slab allocations
+	/// instead of one malloc per object, and siblings end up adjacent in
+	/// memory, which speeds up linear child scans.
+	///
+	/// The arena does not run destructors: owners constructed via `create`
+	/// must have their destructors invoked explicitly before the arena goes
+	/// away (the Object/Node hierarchies do this through their owning-pointer
+	/// deleters).
+	class Arena
+	{
+	public:
+		/// @brief Default slab size in bytes (64 KiB).
+		static constexpr std::size_t DefaultSlabSize{64U * 1024U};
+
+		/// @brief Construct an arena.
+		/// @param slab_size Size of each slab; allocations larger than this get a dedicated slab.
+		explicit Arena(std::size_t slab_size = DefaultSlabSize) : slab_size_{slab_size}
+		{
+		}
+
+		~Arena() = default;
+
+		Arena(const Arena&) = delete;
+		Arena(Arena&&) noexcept = delete;
+		auto operator=(const Arena&) -> Arena& = delete;
+		auto operator=(Arena&&) noexcept -> Arena& = delete;
+
+		/// @brief Allocate raw storage from the current slab.
+		///
+		/// @param size Number of bytes to allocate.
+		/// @param alignment Required alignment of the allocation.
+		/// @return Pointer to uninitialized storage.
+		[[nodiscard]] auto allocate(std::size_t size, std::size_t alignment) -> void*
+		{
+			if (!slabs_.empty())
+			{
+				auto& slab = slabs_.back();
+				const auto offset = (slab.used + alignment - 1) & ~(alignment - 1);
+
+				if (offset + size <= slab.size)
+				{
+					slab.used = offset + size;
+					return slab.memory.get() + offset;
+				}
+			}
+
+			const auto slab_size = std::max(slab_size_, size + alignment);
+			// NOLINTNEXTLINE (cppcoreguidelines-avoid-c-arrays)
+			auto& slab = slabs_.emplace_back(Slab{.memory = std::make_unique<std::byte[]>(slab_size), .size = slab_size, .used = 0});
+
+			const auto base = reinterpret_cast<std::uintptr_t>(slab.memory.get()); // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+			const auto offset = ((base + alignment - 1) & ~(alignment - 1)) - base;
+			slab.used = offset + size;
+			return slab.memory.get() + offset;
+		}
+
+		/// @brief Construct an object of type T in arena storage.
+		///
+		/// The arena will not call T's destructor; the caller owns that
+		/// responsibility.
+		///
+		/// @tparam T Type to construct.
+		/// @tparam Args Constructor argument types for T.
+		/// @param args Arguments forwarded to T's constructor.
+		/// @return Pointer to the constructed object.
+		template <typename T, typename... Args>
+		[[nodiscard]] auto create(Args&&... args) -> T*
+		{
+			return ::new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+		}
+
+		/// @brief Release all slabs at once.
+		///
+		/// Destructors of objects constructed in the arena must already have
+		/// run.
+		auto reset() noexcept -> void
+		{
+			slabs_.clear();
+		}
+
+		/// @brief Get the number of slabs currently held.
+		/// @return Slab count.
+		[[nodiscard]] auto slab_count() const noexcept -> std::size_t
+		{
+			return slabs_.size();
+		}
+
+	private:
+		/// @brief One contiguous block of arena storage.
+		struct Slab
+		{
+			// NOLINTNEXTLINE (cppcoreguidelines-avoid-c-arrays)
+			std::unique_ptr<std::byte[]> memory;
+			std::size_t size{};
+			std::size_t used{};
+		};
+
+		std::vector<Slab> slabs_;
+		std::size_t slab_size_;
+	};
+}
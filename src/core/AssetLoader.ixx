@@ -0,0 +1,278 @@
+module;
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+export module druid.core.AssetLoader;
+
+import druid.core.Engine;
+import druid.core.File;
+import druid.core.Signal;
+
+export namespace druid::core
+{
+	/// @class AssetLoader
+	/// @brief Engine service that loads files on background threads.
+	///
+	/// `AssetLoader` accepts load requests from the engine thread, performs the
+	/// file reads on a small worker pool, and delivers results back on the
+	/// engine thread during its `update` hook — so a 50 MB read never stalls a
+	/// frame, and completion callbacks run where the rest of the engine state
+	/// is safe to touch.
+	///
+	/// Requests carry a priority: queued requests are served highest priority
+	/// first (FIFO within a priority), so bulk startup loads can saturate disk
+	/// bandwidth at `Priority::Low` while in-game streaming requests jump the
+	/// queue at `Priority::High`.
+	///
+	/// Results are exposed two ways:
+	/// - Poll the returned `Handle` (`ready()`/`data()`).
+	/// - Attach a per-request completion callback, or subscribe to the
+	///   `on_loaded` signal for every completion; both fire on the engine
+	///   thread.
+	class AssetLoader : public Service
+	{
+	public:
+		/// @brief Number of background loader threads.
+		static constexpr auto DefaultThreadCount{2U};
+
+		/// @enum Priority
+		/// @brief Request urgency; higher priorities are served first.
+		enum class Priority : std::uint8_t
+		{
+			/// @brief Bulk/startup loads.
+			Low,
+			/// @brief Default request priority.
+			Normal,
+			/// @brief Latency-sensitive streaming loads.
+			High
+		};
+
+		class Handle;
+
+	private:
+		/// @brief Shared state between a request's handle and the worker pool.
+		struct State
+		{
+			std::filesystem::path path;
+			std::vector<std::byte> bytes;
+			Delegate<void(const Handle&)> callback;
+			std::uint64_t sequence{};
+			Priority priority{Priority::Normal};
+			std::atomic<bool> ready{};
+		};
+
+	public:
+		/// @class Handle
+		/// @brief Pollable handle to an in-flight or completed load request.
+		class Handle
+		{
+		public:
+			/// @brief Construct an empty (invalid) handle.
+			Handle() = default;
+
+			/// @brief Tells whether this handle refers to a request.
+			/// @return True if the handle is bound to a request.
+			[[nodiscard]] auto valid() const noexcept -> bool
+			{
+				return state_ != nullptr;
+			}
+
+			/// @brief Tells whether the load has completed.
+			/// @return True once the file contents are available.
+			[[nodiscard]] auto ready() const noexcept -> bool
+			{
+				return state_ != nullptr && state_->ready.load(std::memory_order_acquire);
+			}
+
+			/// @brief Get the loaded file contents.
+			/// @return Byte view of the contents; empty until ready (or on read failure).
+			[[nodiscard]] auto data() const noexcept -> std::span<const std::byte>
+			{
+				return ready() ? std::span<const std::byte>{state_->bytes} : std::span<const std::byte>{};
+			}
+
+			/// @brief Get the path this request loads.
+			/// @return Requested path; empty for an invalid handle.
+			[[nodiscard]] auto path() const -> const std::filesystem::path&
+			{
+				static const std::filesystem::path empty;
+				return state_ != nullptr ? state_->path : empty;
+			}
+
+		private:
+			friend class AssetLoader;
+
+			explicit Handle(std::shared_ptr<State> x) : state_{std::move(x)}
+			{
+			}
+
+			std::shared_ptr<State> state_;
+		};
+
+		/// @brief Construct the loader service and start its worker pool.
+		/// @param x Owning engine instance.
+		explicit AssetLoader(Engine& x) : Service{x}
+		{
+			for (auto i = 0U; i < DefaultThreadCount; i++)
+			{
+				workers_.emplace_back([this] { worker(); });
+			}
+		}
+
+		/// @brief Stop the workers and join them.
+		///
+		/// Requests still queued are abandoned; their handles never become
+		/// ready.
+		~AssetLoader() override
+		{
+			{
+				const std::scoped_lock lock{mutex_};
+				stop_ = true;
+			}
+
+			available_.notify_all();
+
+			for (auto& worker : workers_)
+			{
+				worker.join();
+			}
+		}
+
+		AssetLoader(const AssetLoader&) = delete;
+		AssetLoader(AssetLoader&&) noexcept = delete;
+		auto operator=(const AssetLoader&) -> AssetLoader& = delete;
+		auto operator=(AssetLoader&&) noexcept -> AssetLoader& = delete;
+
+		/// @brief Queue a file load.
+		///
+		/// @param path File to load.
+		/// @param priority Request urgency.
+		/// @return Handle for polling the result.
+		[[nodiscard]] auto request(const std::filesystem::path& path, Priority priority = Priority::Normal) -> Handle
+		{
+			auto state = std::make_shared<State>();
+			state->path = path;
+			state->priority = priority;
+
+			{
+				const std::scoped_lock lock{mutex_};
+				state->sequence = sequence_++;
+				pending_.push_back(state);
+			}
+
+			available_.notify_one();
+			return Handle{std::move(state)};
+		}
+
+		/// @brief Queue a file load with a completion callback.
+		///
+		/// The callback is invoked on the engine thread during this service's
+		/// `update`, with the ready handle.
+		///
+		/// @tparam Callback Callable type invocable with `const Handle&`.
+		/// @param path File to load.
+		/// @param callback Invoked on the engine thread once the load completes.
+		/// @param priority Request urgency.
+		/// @return Handle for polling the result.
+		template <typename Callback>
+		auto request(const std::filesystem::path& path, Callback&& callback, Priority priority = Priority::Normal) -> Handle
+		{
+			auto handle = request(path, priority);
+			handle.state_->callback = std::forward<Callback>(callback);
+			return handle;
+		}
+
+		/// @brief Per-frame update hook: deliver completed loads.
+		///
+		/// Drains the completed list and fires per-request callbacks and the
+		/// `on_loaded` signal on the engine thread.
+		auto update(std::chrono::steady_clock::duration /*x*/) -> void override
+		{
+			delivered_.clear();
+
+			{
+				const std::scoped_lock lock{mutex_};
+				std::swap(delivered_, completed_);
+			}
+
+			for (const auto& state : delivered_)
+			{
+				const Handle handle{state};
+
+				if (state->callback)
+				{
+					state->callback(handle);
+				}
+
+				on_loaded_(handle);
+			}
+		}
+
+		/// @brief Subscribe to every completed load.
+		///
+		/// The callback is invoked on the engine thread with the ready handle.
+		///
+		/// @tparam Callback Callable type invocable with `const Handle&`.
+		/// @param x Callback to connect.
+		template <typename Callback>
+		auto on_loaded(Callback&& x) -> void
+		{
+			on_loaded_.connect(std::forward<Callback>(x));
+		}
+
+	private:
+		/// @brief Worker loop: serve the highest-priority pending request.
+		auto worker() -> void
+		{
+			std::unique_lock lock{mutex_};
+
+			for (;;)
+			{
+				available_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+
+				if (stop_)
+				{
+					return;
+				}
+
+				// Highest priority first; FIFO within a priority.
+				const auto it = std::ranges::max_element(pending_, [](const auto& a, const auto& b)
+														 { return std::pair{a->priority, b->sequence} < std::pair{b->priority, a->sequence}; });
+
+				auto state = std::move(*it);
+				*it = std::move(pending_.back());
+				pending_.pop_back();
+
+				lock.unlock();
+
+				state->bytes = ReadFile(state->path);
+				state->ready.store(true, std::memory_order_release);
+
+				lock.lock();
+				completed_.push_back(std::move(state));
+			}
+		}
+
+		std::vector<std::thread> workers_;
+		std::vector<std::shared_ptr<State>> pending_;
+		std::vector<std::shared_ptr<State>> completed_;
+		std::vector<std::shared_ptr<State>> delivered_;
+		std::mutex mutex_;
+		std::condition_variable available_;
+		Signal<void(const Handle&)> on_loaded_;
+		std::uint64_t sequence_{};
+		bool stop_{false};
+	};
+}
@@ -0,0 +1,97 @@
+module;
+
+#include <chrono>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+export module druid.core.DestructionQueue;
+
+export namespace druid::core
+{
+	/// @class DestructionQueue
+	/// @brief Deferred teardown queue for detached subtrees.
+	///
+	/// Destroying a large subtree runs its whole recursive destructor chain —
+	/// including destruction signals — synchronously, which turns bulk
+	/// despawns into mid-frame latency spikes. Instead, detach the subtree in
+	/// O(1) (see `Object::detach`/`Node::detach`) and push the owning pointer
+	/// here; the actual teardown runs in `flush`, either all at once at a
+	/// defined frame point or time-sliced across frames under a budget:
+	///
+	/// @code
+	/// engine.on_update_end([&queue] { queue.flush(std::chrono::microseconds{500}); });
+	/// @endcode
+	///
+	/// Queued subtrees stay alive (but detached) until flushed; destruction
+	/// order across entries is unspecified.
+	///
+	/// @tparam T Owning pointer type (e.g., `ObjectPtr`, `NodePtr`).
+	template <typename T>
+	class DestructionQueue
+	{
+	public:
+		/// @brief Queue an owning pointer for deferred destruction.
+		/// @param x Subtree to destroy later; null pointers are ignored.
+		auto push(T x) -> void
+		{
+			if (x != nullptr)
+			{
+				pending_.push_back(std::move(x));
+			}
+		}
+
+		/// @brief Destroy every queued subtree.
+		/// @return Number of entries destroyed.
+		auto flush() -> std::size_t
+		{
+			const auto count = pending_.size();
+			pending_.clear();
+			return count;
+		}
+
+		/// @brief Destroy queued subtrees until a time budget is spent.
+		///
+		/// Entries are destroyed one at a time with the elapsed time checked
+		/// between them, so a frame never pays more than the budget plus one
+		/// subtree's teardown. Remaining entries carry over to the next flush.
+		///
+		/// @param x Time budget for this flush.
+		/// @return Number of entries destroyed.
+		auto flush(std::chrono::steady_clock::duration x) -> std::size_t
+		{
+			const auto start = std::chrono::steady_clock::now();
+			auto count = std::size_t{0};
+
+			while (!pending_.empty())
+			{
+				pending_.pop_back();
+				count++;
+
+				if (std::chrono::steady_clock::now() - start >= x)
+				{
+					break;
+				}
+			}
+
+			return count;
+		}
+
+		/// @brief Get the number of subtrees awaiting destruction.
+		/// @return Pending entry count.
+		[[nodiscard]] auto size() const noexcept -> std::size_t
+		{
+			return pending_.size();
+		}
+
+		/// @brief Tells whether no subtrees are pending.
+		/// @return True if the queue is empty.
+		[[nodiscard]] auto empty() const noexcept -> bool
+		{
+			return pending_.empty();
+		}
+
+	private:
+		std::vector<T> pending_;
+	};
+}
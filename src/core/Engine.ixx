@@ -1,13 +1,27 @@
 module;
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <format>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <utility>
 #include <variant>
 #include <vector>
 
 export module druid.core.Engine;
 
 import druid.core.Event;
+import druid.core.EventBus;
+import druid.core.EventQueue;
+import druid.core.JobSystem;
+import druid.core.Profiler;
 import druid.core.Signal;
 
 export namespace druid::core
@@ -71,8 +85,40 @@ export namespace druid::core
 			return engine_;
 		}
 
+		/// @brief Get this service's display name.
+		///
+		/// Used to label profiler slots and diagnostics. Subclasses should
+		/// override this with something recognizable (e.g. "window").
+		///
+		/// @return Display name of the service.
+		[[nodiscard]] virtual auto name() const -> std::string_view
+		{
+			return "service";
+		}
+
+		/// @brief Set the update phase this service belongs to.
+		///
+		/// When the engine runs with a job system, services in the same phase
+		/// are updated in parallel; phases run in ascending order. Services
+		/// that read state written by another service should be placed in a
+		/// later phase.
+		///
+		/// @param x Phase index (default 0).
+		auto set_phase(int x) noexcept -> void
+		{
+			phase_ = x;
+		}
+
+		/// @brief Get the update phase this service belongs to.
+		/// @return Phase index.
+		[[nodiscard]] auto get_phase() const noexcept -> int
+		{
+			return phase_;
+		}
+
 	private:
 		Engine& engine_;
+		int phase_{};
 	};
 
 	/// @concept ServiceType
@@ -80,6 +126,9 @@ export namespace druid::core
 	template <typename T>
 	concept ServiceType = std::is_base_of_v<Service, T>;
 
+	/// @brief Opaque handle identifying a scheduled timer.
+	using TimerHandle = std::uint64_t;
+
 	/// @class Engine
 	/// @brief Core runtime that manages services, update cadence, and event dispatch.
 	///
@@ -101,36 +150,77 @@ export namespace druid::core
 		///
 		/// This limit helps prevent spiraling fixed-update catchup in extreme stalls.
 		static constexpr auto DefaultUpdateFixedLimit{5};
+		/// @brief Margin reserved for the spin phase of the frame pacer.
+		///
+		/// The pacer sleeps until this long before the frame target, then spins
+		/// the rest — OS sleeps routinely overshoot by a scheduler quantum, so
+		/// sleeping all the way to the target would blow the frame budget.
+		static constexpr auto PacerSpinMargin{std::chrono::milliseconds{2}};
+		/// @brief Consecutive overrun frames before the governor lengthens the fixed interval.
+		static constexpr auto GovernorOverrunStreak{5};
+		/// @brief Consecutive clean frames before the governor shortens the fixed interval.
+		static constexpr auto GovernorRecoveryStreak{240};
 
 		/// @brief Construct an engine with default timing configuration.
 		Engine()
 		{
-			on_update(
-				[this](auto x)
-				{
-					for (auto& service : services_)
-					{
-						service->update(x);
-					}
-				});
+			on_update([this](auto x) { update_services(x, false); });
 
-			on_update_fixed(
-				[this](auto x)
-				{
-					for (auto& service : services_)
-					{
-						service->update_fixed(x);
-					}
-				});
+			on_update_fixed([this](auto x) { update_services(x, true); });
 
 			on_update_end(
 				[this]
 				{
-					for (auto& service : services_)
+					ensure_service_slots();
+
+					for (std::size_t i = 0; i < services_.size(); i++)
 					{
-						service->update_end();
+						const auto scope = profiler_.scope(service_slots_[i].end);
+						services_[i]->update_end();
 					}
 				});
+
+			slot_events_ = profiler_.slot("engine::events");
+			slot_timers_ = profiler_.slot("engine::timers");
+			slot_update_ = profiler_.slot("engine::update");
+			slot_update_fixed_ = profiler_.slot("engine::update_fixed");
+			slot_update_end_ = profiler_.slot("engine::update_end");
+			slot_phase_ = profiler_.slot("engine::phase");
+		}
+
+		/// @brief Enable parallel service scheduling backed by a job system.
+		///
+		/// Once enabled, each frame's `update` and `update_fixed` passes fan
+		/// services out across the job system's worker threads, grouped by
+		/// `Service::get_phase()`: services sharing a phase run in parallel and
+		/// phases run in ascending order. End-of-frame callbacks remain
+		/// sequential so presentation order is preserved.
+		///
+		/// @param threads Number of worker threads; defaults to the hardware concurrency.
+		auto enable_jobs(unsigned int threads = std::thread::hardware_concurrency()) -> void
+		{
+			jobs_ = std::make_unique<JobSystem>(threads);
+		}
+
+		/// @brief Get the engine's job system.
+		/// @return Pointer to the job system, or nullptr when parallel scheduling is disabled.
+		[[nodiscard]] auto jobs() noexcept -> JobSystem*
+		{
+			return jobs_.get();
+		}
+
+		/// @brief Get the engine's frame profiler.
+		///
+		/// Each frame the engine times event dispatch, the update and fixed
+		/// update passes, end-of-frame work, and every service hook under
+		/// labels like "window[0]::update". Query `Profiler::samples()` or
+		/// feed `Profiler::report()` to an overlay. When instrumentation is
+		/// compiled out (`Profiler::Enabled` is false), samples stay empty.
+		///
+		/// @return Reference to the profiler.
+		[[nodiscard]] auto profiler() noexcept -> Profiler&
+		{
+			return profiler_;
 		}
 
 		/// @brief Set the interval at which the fixed update function is called.
@@ -147,6 +237,179 @@ export namespace druid::core
 			return interval_fixed_;
 		}
 
+		/// @brief Bound the fixed interval and enable the adaptive governor.
+		///
+		/// Under sustained overload — `GovernorOverrunStreak` consecutive
+		/// frames hitting the fixed-update limit — the fixed interval is
+		/// lengthened by a quarter (clamped to `max`), trading simulation rate
+		/// for keeping pace with the wall clock. After `GovernorRecoveryStreak`
+		/// consecutive clean frames it is shortened again (clamped to `min`).
+		/// Without bounds set the interval never adapts.
+		///
+		/// @param min Shortest fixed interval the governor may select.
+		/// @param max Longest fixed interval the governor may select.
+		auto set_interval_fixed_bounds(std::chrono::steady_clock::duration min, std::chrono::steady_clock::duration max) -> void
+		{
+			interval_min_ = min;
+			interval_max_ = max;
+			interval_fixed_ = std::clamp(interval_fixed_, min, max);
+		}
+
+		/// @brief Get the number of frames that hit the fixed-update limit.
+		///
+		/// Each overrun frame dropped at least one whole fixed step of
+		/// accumulated time; see `get_drift` for how much.
+		///
+		/// @return Count of overrun frames since the engine was constructed.
+		[[nodiscard]] auto get_overruns() const noexcept -> std::uint64_t
+		{
+			return overruns_;
+		}
+
+		/// @brief Get the total simulated time dropped by overrun frames.
+		///
+		/// The amount by which the simulation has fallen behind the wall
+		/// clock; zero while the simulation keeps up.
+		///
+		/// @return Accumulated dropped time.
+		[[nodiscard]] auto get_drift() const noexcept -> std::chrono::steady_clock::duration
+		{
+			return drift_;
+		}
+
+		/// @brief Subscribe a callback to fixed-update overruns.
+		///
+		/// Fired on each frame that hits the fixed-update limit with time
+		/// still accumulated, with the amount of simulated time dropped.
+		///
+		/// @tparam Callback Callable type with signature `void(std::chrono::steady_clock::duration)`.
+		/// @param x Callback to connect.
+		template <typename Callback>
+		auto on_overrun(Callback&& x) -> void
+		{
+			on_overrun_.connect(std::forward<Callback>(x));
+		}
+
+		/// @brief Set a target frame duration for the main loop.
+		///
+		/// When non-zero, the loop paces itself to this duration at the end of
+		/// each frame with a sleep/spin hybrid: it sleeps the bulk of the slack
+		/// and spins the final `PacerSpinMargin` for precision. A zero duration
+		/// (the default) leaves the loop uncapped, e.g. when the renderer's
+		/// vsync already paces the frame.
+		///
+		/// @param x Target frame duration; zero disables pacing.
+		auto set_interval_frame(std::chrono::steady_clock::duration x) -> void
+		{
+			interval_frame_ = x;
+		}
+
+		/// @brief Get the target frame duration.
+		/// @return The target frame duration; zero when pacing is disabled.
+		[[nodiscard]] auto get_interval_frame() const noexcept -> std::chrono::steady_clock::duration
+		{
+			return interval_frame_;
+		}
+
+		/// @brief Run simulated time in exact fixed steps, decoupled from the clock.
+		///
+		/// In deterministic mode each loop iteration advances simulated time by
+		/// exactly one fixed interval — frame deltas equal `interval_fixed`,
+		/// every frame runs exactly one fixed update, and frame pacing is
+		/// bypassed. Wall-clock speed then depends only on how fast the
+		/// services execute, so a ten-minute match simulates in seconds and
+		/// replays are bit-identical across machines.
+		///
+		/// @param x True to advance time in fixed steps.
+		auto set_deterministic(bool x) noexcept -> void
+		{
+			deterministic_ = x;
+		}
+
+		/// @brief Tells whether deterministic tick mode is enabled.
+		/// @return True when simulated time advances in fixed steps.
+		[[nodiscard]] auto get_deterministic() const noexcept -> bool
+		{
+			return deterministic_;
+		}
+
+		/// @brief Get the fixed-timestep interpolation factor for this frame.
+		///
+		/// The fraction of a fixed interval left unsimulated after the frame's
+		/// fixed-update catchup (`accumulate / interval_fixed`, in [0, 1)).
+		/// Rendering between fixed states at
+		/// `previous + (current - previous) * alpha` removes the judder of
+		/// frames landing between fixed steps.
+		///
+		/// @return Interpolation factor in [0, 1).
+		[[nodiscard]] auto get_alpha() const noexcept -> float
+		{
+			return alpha_;
+		}
+
+		/// @brief Get the accumulated engine time.
+		///
+		/// Advances by each frame's delta, so in deterministic mode it tracks
+		/// simulated time rather than the wall clock. Timers are keyed to it.
+		///
+		/// @return Time accumulated since `run()` started.
+		[[nodiscard]] auto get_time() const noexcept -> std::chrono::steady_clock::duration
+		{
+			return clock_;
+		}
+
+		/// @brief Schedule a one-shot timer.
+		///
+		/// The callback runs on the engine thread at the defined timer point of
+		/// the frame (after event dispatch, before updates), on the first frame
+		/// whose accumulated time reaches the deadline. Pending timers cost one
+		/// deadline comparison per frame, not a dispatch.
+		///
+		/// @tparam Callback Callable type with signature `void()`.
+		/// @param delay Delay from now until the callback fires.
+		/// @param x Callback to invoke once.
+		/// @return Handle for `cancel_timer`.
+		template <typename Callback>
+		auto add_timer(std::chrono::steady_clock::duration delay, Callback&& x) -> TimerHandle
+		{
+			return push_timer(delay, {}, std::forward<Callback>(x));
+		}
+
+		/// @brief Schedule a repeating timer.
+		///
+		/// Fires at most once per frame; if frames run longer than the
+		/// interval, missed occurrences are skipped rather than bursted.
+		///
+		/// @tparam Callback Callable type with signature `void()`.
+		/// @param interval Period between invocations; must be positive.
+		/// @param x Callback to invoke each period.
+		/// @return Handle for `cancel_timer`.
+		template <typename Callback>
+		auto add_timer_repeating(std::chrono::steady_clock::duration interval, Callback&& x) -> TimerHandle
+		{
+			return push_timer(interval, interval, std::forward<Callback>(x));
+		}
+
+		/// @brief Cancel a scheduled timer.
+		///
+		/// Safe to call from a timer callback, including the timer's own.
+		///
+		/// @param x Handle returned by `add_timer`/`add_timer_repeating`.
+		/// @return True if the timer was still pending.
+		auto cancel_timer(TimerHandle x) -> bool
+		{
+			// The firing timer is popped off the heap while its callback runs,
+			// so it must still count as pending for self-cancellation.
+			const auto pending = !cancelled_.contains(x) && (x == firing_ || std::ranges::any_of(timers_, [x](const Timer& timer) { return timer.handle == x; }));
+
+			if (pending)
+			{
+				cancelled_.insert(x);
+			}
+
+			return pending;
+		}
+
 		/// @brief Run the main loop of the engine. This will block until quit() is called.
 		/// @return The exit code of the engine.
 		auto run() -> int
@@ -160,11 +423,28 @@ export namespace druid::core
 				while (running_)
 				{
 					const auto now = std::chrono::steady_clock::now();
-					const auto delta = now - start_;
+					const auto delta = deterministic_ ? interval_fixed_ : now - start_;
 					start_ = now;
 					accumulate_ += delta;
+					clock_ += delta;
+
+					profiler_.begin_frame();
 
-					on_update_(delta);
+					{
+						const auto scope = profiler_.scope(slot_events_);
+						dispatch_posted_events();
+						bus_.dispatch();
+					}
+
+					{
+						const auto scope = profiler_.scope(slot_timers_);
+						dispatch_timers();
+					}
+
+					{
+						const auto scope = profiler_.scope(slot_update_);
+						on_update_(delta);
+					}
 
 					auto count = 0;
 
@@ -173,10 +453,25 @@ export namespace druid::core
 						accumulate_ -= interval_fixed_;
 						count++;
 
+						const auto scope = profiler_.scope(slot_update_fixed_);
 						on_update_fixed_(interval_fixed_);
 					}
 
-					on_update_end_();
+					govern(count);
+
+					alpha_ = interval_fixed_.count() > 0
+								 ? static_cast<float>(accumulate_.count()) / static_cast<float>(interval_fixed_.count())
+								 : 0.0F;
+
+					{
+						const auto scope = profiler_.scope(slot_update_end_);
+						on_update_end_();
+					}
+
+					if (!deterministic_)
+					{
+						pace(now);
+					}
 				}
 
 				return EXIT_SUCCESS;
@@ -251,6 +546,51 @@ export namespace druid::core
 				x);
 		}
 
+		/// @brief Post an event for deferred dispatch, safe from any thread.
+		///
+		/// Events are buffered in a lock-free queue and drained in one batch at
+		/// the start of the next frame, sorted by event type so the dispatcher
+		/// delivers same-type events as runs. This is the entry point for
+		/// events produced off the engine thread (e.g., a netcode thread).
+		///
+		/// @param x Event to post.
+		/// @return True if the event was queued; false if the queue is full.
+		auto post(const Event& x) -> bool
+		{
+			return queue_.try_post(x);
+		}
+
+		/// @brief Subscribe a callback to a typed event channel.
+		///
+		/// Channels are per-type and resolved at compile time, so dispatch is
+		/// a direct indexed lookup over a flat delegate list — no variant
+		/// visitation. Any copyable type works as an event, so gameplay code
+		/// can define its own event types without touching the engine.
+		///
+		/// @tparam E Event type to subscribe to.
+		/// @tparam Callback Callable type with signature `void(const E&)`.
+		/// @param x Callback to connect.
+		template <typename E, typename Callback>
+		auto subscribe(Callback&& x) -> void
+		{
+			bus_.subscribe<E>(std::forward<Callback>(x));
+		}
+
+		/// @brief Publish an event on its typed channel.
+		///
+		/// The payload is appended to the channel's contiguous queue and
+		/// delivered at the events point of the next frame, after posted
+		/// events — same-type events arrive at subscribers as one
+		/// cache-friendly run.
+		///
+		/// @tparam E Event type; deduced from the argument.
+		/// @param x Event to publish.
+		template <typename E>
+		auto publish(const E& x) -> void
+		{
+			bus_.publish(x);
+		}
+
 		/// @brief Subscribe a callback to window events.
 		/// @tparam Callback Callable type with signature `void(const EventWindow&)`.
 		/// @param x Callback to connect.
@@ -306,7 +646,257 @@ export namespace druid::core
 		}
 
 	private:
+		/// @brief Profiler slot indices for one service's hooks.
+		struct ServiceSlots
+		{
+			std::size_t update{};
+			std::size_t fixed{};
+			std::size_t end{};
+		};
+
+		/// @brief Create profiler slots for services registered since last time.
+		///
+		/// Slots are labelled "<name>[<index>]::<hook>" so services sharing a
+		/// default name stay distinguishable.
+		auto ensure_service_slots() -> void
+		{
+			while (service_slots_.size() < services_.size())
+			{
+				const auto index = service_slots_.size();
+				const auto name = services_[index]->name();
+
+				service_slots_.push_back({.update = profiler_.slot(std::format("{}[{}]::update", name, index)),
+										  .fixed = profiler_.slot(std::format("{}[{}]::update_fixed", name, index)),
+										  .end = profiler_.slot(std::format("{}[{}]::update_end", name, index))});
+			}
+		}
+
+		/// @brief Run one update or fixed-update pass over all services.
+		///
+		/// Without a job system the services are updated sequentially in
+		/// registration order. With a job system, services are grouped by phase
+		/// and each phase's group is fanned out across the workers, waiting at
+		/// the phase boundary.
+		auto update_services(std::chrono::steady_clock::duration x, bool fixed) -> void
+		{
+			if (jobs_ == nullptr)
+			{
+				ensure_service_slots();
+
+				for (std::size_t i = 0; i < services_.size(); i++)
+				{
+					const auto scope = profiler_.scope(fixed ? service_slots_[i].fixed : service_slots_[i].update);
+					fixed ? services_[i]->update_fixed(x) : services_[i]->update(x);
+				}
+
+				return;
+			}
+
+			scratch_.clear();
+
+			for (auto& service : services_)
+			{
+				scratch_.push_back(service.get());
+			}
+
+			std::ranges::stable_sort(scratch_, {}, &Service::get_phase);
+
+			for (auto it = scratch_.begin(); it != scratch_.end();)
+			{
+				const auto phase = (*it)->get_phase();
+				auto last = it;
+
+				while (last != scratch_.end() && (*last)->get_phase() == phase)
+				{
+					++last;
+				}
+
+				// With jobs enabled, timings are recorded per phase batch;
+				// recording per service from the workers would race.
+				const auto scope = profiler_.scope(slot_phase_);
+
+				for (auto s = it; s != last; ++s)
+				{
+					auto* service = *s;
+					jobs_->submit([service, x, fixed] { fixed ? service->update_fixed(x) : service->update(x); });
+				}
+
+				jobs_->wait();
+				it = last;
+			}
+		}
+
+		/// @brief Account for fixed-update overruns and adapt the interval.
+		///
+		/// A frame that hit the fixed-update limit with a whole step still
+		/// accumulated drops that backlog — letting it build would spiral, as
+		/// every later frame would inherit more catchup work than it can run.
+		/// The drop is counted, surfaced through `on_overrun`, and feeds the
+		/// streak counters driving the optional interval governor.
+		///
+		/// @param x Number of fixed updates the frame executed.
+		auto govern(int x) -> void
+		{
+			if (x < update_fixed_limit_ || accumulate_ < interval_fixed_)
+			{
+				overrun_streak_ = 0;
+				clean_streak_++;
+
+				if (interval_max_ > interval_min_ && clean_streak_ >= GovernorRecoveryStreak)
+				{
+					interval_fixed_ = std::max(interval_fixed_ - (interval_fixed_ / 4), interval_min_);
+					clean_streak_ = 0;
+				}
+
+				return;
+			}
+
+			const auto dropped = accumulate_ - (accumulate_ % interval_fixed_);
+			accumulate_ %= interval_fixed_;
+			overruns_++;
+			drift_ += dropped;
+			overrun_streak_++;
+			clean_streak_ = 0;
+			on_overrun_(dropped);
+
+			if (interval_max_ > interval_min_ && overrun_streak_ >= GovernorOverrunStreak)
+			{
+				interval_fixed_ = std::min(interval_fixed_ + (interval_fixed_ / 4), interval_max_);
+				overrun_streak_ = 0;
+			}
+		}
+
+		/// @brief Hold the loop until the frame's target duration has elapsed.
+		///
+		/// Sleeps until `PacerSpinMargin` before the target, then spins with
+		/// yields for the remainder. No-op when pacing is disabled or the
+		/// frame already ran long.
+		///
+		/// @param x Time point at which the current frame started.
+		auto pace(std::chrono::steady_clock::time_point x) const -> void
+		{
+			if (interval_frame_ <= std::chrono::steady_clock::duration::zero())
+			{
+				return;
+			}
+
+			const auto target = x + interval_frame_;
+
+			if (std::chrono::steady_clock::now() + PacerSpinMargin < target)
+			{
+				std::this_thread::sleep_until(target - PacerSpinMargin);
+			}
+
+			while (std::chrono::steady_clock::now() < target)
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		/// @brief One scheduled timer in the deadline min-heap.
+		struct Timer
+		{
+			std::chrono::steady_clock::duration due{};
+			std::chrono::steady_clock::duration interval{};
+			TimerHandle handle{};
+			std::function<void()> callback;
+		};
+
+		/// @brief Orders the timer vector as a min-heap on the deadline.
+		static constexpr auto TimerLater = [](const Timer& a, const Timer& b) { return a.due > b.due; };
+
+		/// @brief Insert a timer into the deadline heap.
+		template <typename Callback>
+		auto push_timer(std::chrono::steady_clock::duration delay, std::chrono::steady_clock::duration interval, Callback&& x) -> TimerHandle
+		{
+			const auto handle = next_timer_++;
+			timers_.push_back({.due = clock_ + delay, .interval = interval, .handle = handle, .callback = std::forward<Callback>(x)});
+			std::ranges::push_heap(timers_, TimerLater);
+			return handle;
+		}
+
+		/// @brief Fire every timer whose deadline has been reached.
+		///
+		/// Pops due timers off the min-heap in deadline order — one comparison
+		/// against the heap front tells whether anything fires this frame.
+		/// Repeating timers are re-armed past the current time so a long frame
+		/// skips missed occurrences instead of bursting them.
+		auto dispatch_timers() -> void
+		{
+			while (!timers_.empty() && timers_.front().due <= clock_)
+			{
+				std::ranges::pop_heap(timers_, TimerLater);
+				auto timer = std::move(timers_.back());
+				timers_.pop_back();
+
+				if (cancelled_.erase(timer.handle) > 0)
+				{
+					continue;
+				}
+
+				firing_ = timer.handle;
+				timer.callback();
+				firing_ = 0;
+
+				// Erase unconditionally: a one-shot cancelling itself from its
+				// own callback must not leave its handle behind.
+				const auto cancelled = cancelled_.erase(timer.handle) > 0;
+
+				if (timer.interval <= std::chrono::steady_clock::duration::zero() || cancelled)
+				{
+					continue;
+				}
+
+				do
+				{
+					timer.due += timer.interval;
+				} while (timer.due <= clock_);
+
+				timers_.push_back(std::move(timer));
+				std::ranges::push_heap(timers_, TimerLater);
+			}
+		}
+
+		/// @brief Drain cross-thread posted events and dispatch them in one batch.
+		///
+		/// Events are sorted by variant index (stable within a type) so the
+		/// dispatcher handles bursts of same-type events back to back.
+		auto dispatch_posted_events() -> void
+		{
+			pending_.clear();
+			queue_.drain(pending_);
+
+			if (pending_.empty())
+			{
+				return;
+			}
+
+			std::ranges::stable_sort(pending_, {}, [](const Event& e) { return e.index(); });
+
+			for (const auto& pending : pending_)
+			{
+				event(pending);
+			}
+		}
+
 		std::vector<std::unique_ptr<Service>> services_;
+		std::vector<Service*> scratch_;
+		std::vector<ServiceSlots> service_slots_;
+		std::unique_ptr<JobSystem> jobs_;
+		EventQueue queue_;
+		EventBus bus_;
+		std::vector<Event> pending_;
+		std::vector<Timer> timers_;
+		std::unordered_set<TimerHandle> cancelled_;
+		TimerHandle next_timer_{1};
+		TimerHandle firing_{};
+		Profiler profiler_;
+		std::size_t slot_events_{};
+		std::size_t slot_timers_{};
+		std::size_t slot_update_{};
+		std::size_t slot_update_fixed_{};
+		std::size_t slot_update_end_{};
+		std::size_t slot_phase_{};
 
 		Signal<void(std::chrono::steady_clock::duration)> on_update_;
 		Signal<void(std::chrono::steady_clock::duration)> on_update_fixed_;
@@ -314,11 +904,22 @@ export namespace druid::core
 		Signal<void(const druid::core::EventWindow&)> on_event_window_;
 		Signal<void(const druid::core::EventKeyboard&)> on_event_keyboard_;
 		Signal<void(const druid::core::EventMouse&)> on_event_mouse_;
+		Signal<void(std::chrono::steady_clock::duration)> on_overrun_;
 
 		std::chrono::steady_clock::time_point start_;
 		std::chrono::steady_clock::duration accumulate_{};
+		std::chrono::steady_clock::duration clock_{};
 		std::chrono::steady_clock::duration interval_fixed_{DefaultIntervalFixed};
+		std::chrono::steady_clock::duration interval_frame_{};
+		std::chrono::steady_clock::duration interval_min_{};
+		std::chrono::steady_clock::duration interval_max_{};
+		std::chrono::steady_clock::duration drift_{};
+		std::uint64_t overruns_{};
+		int overrun_streak_{};
+		int clean_streak_{};
+		float alpha_{};
 		int update_fixed_limit_{DefaultUpdateFixedLimit};
 		bool running_{false};
+		bool deterministic_{false};
 	};
 }
@@ -2,6 +2,7 @@
 /// @module druid.core.enummask
 module;
 
+#include <bit>
 #include <initializer_list>
 #include <type_traits>
 
@@ -29,6 +30,46 @@ export namespace druid::core
 		/// @brief Underlying integer type of the enum.
 		using UnderlyingType = std::underlying_type_t<T>;
 
+		/// @brief Unsigned image of the underlying type, used for bit scans.
+		using UnsignedType = std::make_unsigned_t<UnderlyingType>;
+
+		/// @class Iterator
+		/// @brief Forward iterator over the set bits of a mask.
+		///
+		/// Dereferencing yields the enumerator for the lowest set bit;
+		/// incrementing clears it. Each step is one `std::countr_zero` and one
+		/// bit-clear, so iterating a sparse mask never scans unset flags.
+		class Iterator
+		{
+		public:
+			/// @brief Construct an iterator over the given raw bits.
+			/// @param x Remaining set bits to visit.
+			constexpr explicit Iterator(UnsignedType x) noexcept : bits_{x}
+			{
+			}
+
+			/// @brief Get the enumerator for the lowest remaining set bit.
+			/// @return Enum value of the current flag.
+			[[nodiscard]] constexpr auto operator*() const noexcept -> T
+			{
+				return static_cast<T>(static_cast<UnderlyingType>(UnsignedType{1} << static_cast<UnsignedType>(std::countr_zero(bits_))));
+			}
+
+			/// @brief Advance to the next set bit.
+			/// @return Reference to this iterator.
+			constexpr auto operator++() noexcept -> Iterator&
+			{
+				bits_ &= static_cast<UnsignedType>(bits_ - UnsignedType{1});
+				return *this;
+			}
+
+			/// @brief Compare two iterators for equality.
+			[[nodiscard]] constexpr auto operator==(const Iterator&) const noexcept -> bool = default;
+
+		private:
+			UnsignedType bits_{};
+		};
+
 		/// @brief Construct an empty mask with all bits cleared.
 		constexpr EnumMask() = default;
 
@@ -88,7 +129,126 @@ export namespace druid::core
 			mask_ = 0;
 		}
 
+		/// @brief Compare two masks for equality.
+		[[nodiscard]] constexpr auto operator==(const EnumMask&) const noexcept -> bool = default;
+
+		/// @brief Union of two masks.
+		/// @param x Mask to combine with.
+		/// @return Mask with the flags of either operand set.
+		[[nodiscard]] constexpr auto operator|(EnumMask x) const noexcept -> EnumMask
+		{
+			return EnumMask{static_cast<UnderlyingType>(mask_ | x.mask_)};
+		}
+
+		/// @brief Intersection of two masks.
+		/// @param x Mask to intersect with.
+		/// @return Mask with only the flags set in both operands.
+		[[nodiscard]] constexpr auto operator&(EnumMask x) const noexcept -> EnumMask
+		{
+			return EnumMask{static_cast<UnderlyingType>(mask_ & x.mask_)};
+		}
+
+		/// @brief Symmetric difference of two masks.
+		/// @param x Mask to combine with.
+		/// @return Mask with the flags set in exactly one operand.
+		[[nodiscard]] constexpr auto operator^(EnumMask x) const noexcept -> EnumMask
+		{
+			return EnumMask{static_cast<UnderlyingType>(mask_ ^ x.mask_)};
+		}
+
+		/// @brief Complement of the mask over the full underlying width.
+		/// @return Mask with every flag flipped.
+		[[nodiscard]] constexpr auto operator~() const noexcept -> EnumMask
+		{
+			return EnumMask{static_cast<UnderlyingType>(~mask_)};
+		}
+
+		/// @brief Set every flag that is set in another mask.
+		/// @param x Mask whose flags to add.
+		/// @return Reference to this mask.
+		constexpr auto operator|=(EnumMask x) noexcept -> EnumMask&
+		{
+			mask_ |= x.mask_;
+			return *this;
+		}
+
+		/// @brief Keep only the flags also set in another mask.
+		/// @param x Mask to intersect with.
+		/// @return Reference to this mask.
+		constexpr auto operator&=(EnumMask x) noexcept -> EnumMask&
+		{
+			mask_ &= x.mask_;
+			return *this;
+		}
+
+		/// @brief Toggle every flag that is set in another mask.
+		/// @param x Mask whose flags to toggle.
+		/// @return Reference to this mask.
+		constexpr auto operator^=(EnumMask x) noexcept -> EnumMask&
+		{
+			mask_ ^= x.mask_;
+			return *this;
+		}
+
+		/// @brief Test whether any flag of another mask is set in this one.
+		/// @param x Flags to test.
+		/// @return True if at least one flag overlaps.
+		[[nodiscard]] constexpr auto any(EnumMask x) const noexcept -> bool
+		{
+			return (mask_ & x.mask_) != 0x0;
+		}
+
+		/// @brief Test whether every flag of another mask is set in this one.
+		/// @param x Flags to test.
+		/// @return True if all of the given flags are set.
+		[[nodiscard]] constexpr auto all(EnumMask x) const noexcept -> bool
+		{
+			return (mask_ & x.mask_) == x.mask_;
+		}
+
+		/// @brief Test whether no flag of another mask is set in this one.
+		/// @param x Flags to test.
+		/// @return True if none of the given flags are set.
+		[[nodiscard]] constexpr auto none(EnumMask x) const noexcept -> bool
+		{
+			return (mask_ & x.mask_) == 0x0;
+		}
+
+		/// @brief Tells whether the mask has no flags set.
+		/// @return True if empty.
+		[[nodiscard]] constexpr auto empty() const noexcept -> bool
+		{
+			return mask_ == 0x0;
+		}
+
+		/// @brief Count the number of set flags.
+		/// @return Population count of the mask.
+		[[nodiscard]] constexpr auto count() const noexcept -> int
+		{
+			return std::popcount(static_cast<UnsignedType>(mask_));
+		}
+
+		/// @brief Get an iterator over the set bits, lowest first.
+		/// @return Iterator at the first set flag.
+		[[nodiscard]] constexpr auto begin() const noexcept -> Iterator
+		{
+			return Iterator{static_cast<UnsignedType>(mask_)};
+		}
+
+		/// @brief Get the end iterator (no bits remaining).
+		/// @return Past-the-end iterator.
+		[[nodiscard]] constexpr auto end() const noexcept -> Iterator
+		{
+			return Iterator{0};
+		}
+
 	private:
+		/// @brief Construct a mask from a raw underlying value.
+		/// @param x Raw bit pattern.
+		constexpr explicit EnumMask(UnderlyingType x) noexcept : mask_{x}
+		{
+		}
+
 		UnderlyingType mask_{};
 	};
 }
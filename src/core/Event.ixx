@@ -188,6 +188,10 @@ export namespace druid::core
 		Type type{Type::None};
 		/// @brief Button associated with the event (if applicable).
 		Button button{Button::None};
+		/// @brief Cursor X-coordinate in window space at the time of the event.
+		float x{};
+		/// @brief Cursor Y-coordinate in window space at the time of the event.
+		float y{};
 	};
 
 	/// @brief Unified engine event type.
@@ -0,0 +1,151 @@
+module;
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+export module druid.core.EventQueue;
+
+import druid.core.Event;
+
+export namespace druid::core
+{
+	/// @class EventQueue
+	/// @brief Lock-free bounded queue for cross-thread event posting.
+	///
+	/// `EventQueue` is a fixed-capacity ring buffer with per-cell sequence
+	/// counters (Vyukov-style), safe for any number of producer threads posting
+	/// concurrently while a single consumer drains. Posting never blocks and
+	/// never allocates; a full queue rejects the event so producers can decide
+	/// whether to drop or retry.
+	///
+	/// The engine drains the queue in one batch at a defined point in the
+	/// frame, which gives worker threads (e.g., a netcode thread) a safe entry
+	/// point into the event system and lets dispatch process same-type events
+	/// as runs.
+	class EventQueue
+	{
+	public:
+		/// @brief Default queue capacity (rounded up to a power of two).
+		static constexpr std::size_t DefaultCapacity{1024};
+
+		/// @brief Construct a queue with the given capacity.
+		/// @param capacity Requested capacity; rounded up to a power of two.
+		explicit EventQueue(std::size_t capacity = DefaultCapacity) : mask_{std::bit_ceil(capacity) - 1}, cells_{std::make_unique<Cell[]>(mask_ + 1)}
+		{
+			for (std::size_t i = 0; i <= mask_; i++)
+			{
+				cells_[i].sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		/// @brief Post an event from any thread.
+		///
+		/// Lock-free and allocation-free. Fails only when the queue is full.
+		///
+		/// @param x Event to enqueue.
+		/// @return True if the event was enqueued; false if the queue is full.
+		auto try_post(const Event& x) -> bool
+		{
+			auto pos = enqueue_.load(std::memory_order_relaxed);
+
+			for (;;)
+			{
+				auto& cell = cells_[pos & mask_];
+				const auto sequence = cell.sequence.load(std::memory_order_acquire);
+				const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+
+				if (difference == 0)
+				{
+					if (enqueue_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					{
+						cell.event = x;
+						cell.sequence.store(pos + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (difference < 0)
+				{
+					return false;
+				}
+				else
+				{
+					pos = enqueue_.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/// @brief Pop a single event (consumer side).
+		/// @param x Receives the popped event on success.
+		/// @return True if an event was popped; false if the queue is empty.
+		auto try_pop(Event& x) -> bool
+		{
+			auto pos = dequeue_.load(std::memory_order_relaxed);
+
+			for (;;)
+			{
+				auto& cell = cells_[pos & mask_];
+				const auto sequence = cell.sequence.load(std::memory_order_acquire);
+				const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+
+				if (difference == 0)
+				{
+					if (dequeue_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					{
+						x = cell.event;
+						cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (difference < 0)
+				{
+					return false;
+				}
+				else
+				{
+					pos = dequeue_.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/// @brief Pop all queued events into a vector (consumer side).
+		///
+		/// Appends to the vector without clearing it, so a reused scratch
+		/// buffer keeps draining allocation-free in steady state.
+		///
+		/// @param x Receives the drained events.
+		auto drain(std::vector<Event>& x) -> void
+		{
+			Event event;
+
+			while (try_pop(event))
+			{
+				x.push_back(event);
+			}
+		}
+
+		/// @brief Get the queue capacity.
+		/// @return Number of events the queue can hold.
+		[[nodiscard]] auto capacity() const noexcept -> std::size_t
+		{
+			return mask_ + 1;
+		}
+
+	private:
+		/// @brief One ring slot plus its sequence counter.
+		struct Cell
+		{
+			std::atomic<std::size_t> sequence{};
+			Event event;
+		};
+
+		std::size_t mask_;
+		// NOLINTNEXTLINE (cppcoreguidelines-avoid-c-arrays)
+		std::unique_ptr<Cell[]> cells_;
+		alignas(64) std::atomic<std::size_t> enqueue_{};
+		alignas(64) std::atomic<std::size_t> dequeue_{};
+	};
+}
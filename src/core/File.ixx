@@ -1,9 +1,25 @@
 module;
 
+#include <cstddef>
 #include <filesystem>
 #include <fstream>
+#include <span>
+#include <utility>
 #include <vector>
 
+#ifdef _WIN32
+	#ifndef WIN32_LEAN_AND_MEAN
+		// NOLINTNEXTLINE (cppcoreguidelines-macro-usage)
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
 export module druid.core.File;
 
 export namespace druid::core
@@ -29,4 +45,213 @@ export namespace druid::core
 		ifs.read(reinterpret_cast<char*>(v.data()), static_cast<std::streamsize>(v.size()));
 		return v;
 	}
+
+	/// @class FileMapping
+	/// @brief Read-only memory-mapped view of a file.
+	///
+	/// `FileMapping` maps a file into the process address space (mmap on POSIX,
+	/// MapViewOfFile on Windows) and exposes it as a `std::span<const
+	/// std::byte>`. Pages are faulted in on demand by the OS, so opening a
+	/// multi-hundred-megabyte asset pack costs neither a copy nor its full
+	/// size in committed memory. If mapping is unavailable the contents are
+	/// read into an owned buffer instead, preserving the same view interface.
+	class FileMapping
+	{
+	public:
+		/// @brief Map a file for read-only access.
+		///
+		/// On mapping failure the file is read into memory as a fallback; use
+		/// `mapped()` to distinguish. An unreadable file yields an empty view.
+		///
+		/// @param x Path to the file to map.
+		explicit FileMapping(const std::filesystem::path& x)
+		{
+#ifdef _WIN32
+			file_ = CreateFileW(x.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+			if (file_ != INVALID_HANDLE_VALUE)
+			{
+				LARGE_INTEGER size{};
+
+				if (GetFileSizeEx(file_, &size) != 0 && size.QuadPart > 0)
+				{
+					mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+					if (mapping_ != nullptr)
+					{
+						view_ = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+
+						if (view_ != nullptr)
+						{
+							data_ = {static_cast<const std::byte*>(view_), static_cast<std::size_t>(size.QuadPart)};
+							return;
+						}
+					}
+				}
+			}
+#else
+			// NOLINTNEXTLINE (cppcoreguidelines-pro-type-vararg)
+			fd_ = ::open(x.c_str(), O_RDONLY);
+
+			if (fd_ >= 0)
+			{
+				struct stat status{};
+
+				if (::fstat(fd_, &status) == 0 && status.st_size > 0)
+				{
+					view_ = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd_, 0);
+
+					if (view_ != MAP_FAILED)
+					{
+						data_ = {static_cast<const std::byte*>(view_), static_cast<std::size_t>(status.st_size)};
+						return;
+					}
+
+					view_ = nullptr;
+				}
+			}
+#endif
+
+			// Mapping failed; fall back to an owned read so callers still get a view.
+			fallback_ = ReadFile(x);
+			data_ = fallback_;
+		}
+
+		/// @brief Unmap the view and release the file.
+		~FileMapping()
+		{
+#ifdef _WIN32
+			if (view_ != nullptr)
+			{
+				UnmapViewOfFile(view_);
+			}
+
+			if (mapping_ != nullptr)
+			{
+				CloseHandle(mapping_);
+			}
+
+			if (file_ != INVALID_HANDLE_VALUE)
+			{
+				CloseHandle(file_);
+			}
+#else
+			if (view_ != nullptr)
+			{
+				::munmap(view_, data_.size());
+			}
+
+			if (fd_ >= 0)
+			{
+				::close(fd_);
+			}
+#endif
+		}
+
+		FileMapping(const FileMapping&) = delete;
+		FileMapping(FileMapping&&) noexcept = delete;
+		auto operator=(const FileMapping&) -> FileMapping& = delete;
+		auto operator=(FileMapping&&) noexcept -> FileMapping& = delete;
+
+		/// @brief Get the mapped file contents.
+		/// @return Read-only byte view of the whole file; empty on failure.
+		[[nodiscard]] auto data() const noexcept -> std::span<const std::byte>
+		{
+			return data_;
+		}
+
+		/// @brief Get the size of the mapped file in bytes.
+		/// @return File size; zero on failure.
+		[[nodiscard]] auto size() const noexcept -> std::size_t
+		{
+			return data_.size();
+		}
+
+		/// @brief Tells whether the view is backed by an actual OS mapping.
+		/// @return True if memory-mapped; false if the read-into-memory fallback was used.
+		[[nodiscard]] auto mapped() const noexcept -> bool
+		{
+			return view_ != nullptr;
+		}
+
+		/// @brief Tells whether the file was opened successfully.
+		/// @return True if the view holds the file's contents.
+		[[nodiscard]] auto valid() const noexcept -> bool
+		{
+			return !data_.empty();
+		}
+
+	private:
+		std::span<const std::byte> data_;
+		std::vector<std::byte> fallback_;
+		void* view_{};
+#ifdef _WIN32
+		HANDLE file_{INVALID_HANDLE_VALUE};
+		HANDLE mapping_{};
+#else
+		int fd_{-1};
+#endif
+	};
+
+	/// @class FileStream
+	/// @brief Chunked sequential reader for streaming decode pipelines.
+	///
+	/// `FileStream` reads a file front to back into caller-provided buffers,
+	/// so large assets can be decoded incrementally with a fixed memory
+	/// footprint instead of materializing the whole file.
+	class FileStream
+	{
+	public:
+		/// @brief Open a file for sequential reading.
+		/// @param x Path to the file to read.
+		explicit FileStream(const std::filesystem::path& x) : stream_{x, std::ios::binary | std::ios::ate}
+		{
+			if (stream_.is_open())
+			{
+				size_ = static_cast<std::size_t>(stream_.tellg());
+				stream_.seekg(0, std::ios::beg);
+			}
+		}
+
+		/// @brief Tells whether the file was opened successfully.
+		/// @return True if the stream is readable.
+		[[nodiscard]] auto valid() const noexcept -> bool
+		{
+			return stream_.is_open();
+		}
+
+		/// @brief Get the total file size in bytes.
+		/// @return File size; zero when invalid.
+		[[nodiscard]] auto size() const noexcept -> std::size_t
+		{
+			return size_;
+		}
+
+		/// @brief Read the next chunk into the given buffer.
+		///
+		/// @param x Destination buffer; its size is the maximum chunk size.
+		/// @return Number of bytes read; zero at end of file or on error.
+		auto read(std::span<std::byte> x) -> std::size_t
+		{
+			if (!stream_.is_open() || x.empty())
+			{
+				return 0;
+			}
+
+			// NOLINTNEXTLINE (cppcoreguidelines-pro-type-reinterpret-cast)
+			stream_.read(reinterpret_cast<char*>(x.data()), static_cast<std::streamsize>(x.size()));
+			return static_cast<std::size_t>(stream_.gcount());
+		}
+
+		/// @brief Tells whether the end of the file has been reached.
+		/// @return True once all bytes have been consumed.
+		[[nodiscard]] auto eof() const noexcept -> bool
+		{
+			return stream_.eof() || !stream_.is_open();
+		}
+
+	private:
+		std::ifstream stream_;
+		std::size_t size_{};
+	};
 }
@@ -0,0 +1,221 @@
+module;
+
+#include <bitset>
+#include <cstddef>
+#include <string_view>
+
+export module druid.core.Input;
+
+import druid.core.Engine;
+import druid.core.Event;
+
+export namespace druid::core
+{
+	/// @class Input
+	/// @brief Engine service that folds input events into polled state tables.
+	///
+	/// Subscribes once to the engine's keyboard and mouse channels and keeps
+	/// packed bitsets of key/button state: currently down, pressed this frame,
+	/// and released this frame, plus the cursor position and per-frame motion
+	/// delta. Gameplay code polls with constant-time inline queries instead of
+	/// each service maintaining its own event callbacks and state table.
+	///
+	/// Edge state (`is_pressed`/`is_released`, mouse delta) is valid for the
+	/// frame the events were dispatched in and resets in `update_end`.
+	///
+	/// @note `EventKeyboard::Key` enumerators are sequential indices, not bit
+	///       flags, so the state tables are bitsets indexed by key rather than
+	///       `EnumMask` values.
+	class Input : public Service
+	{
+	public:
+		/// @brief Canonical key identifiers, re-exported for query call sites.
+		using Key = EventKeyboard::Key;
+		/// @brief Mouse button identifiers, re-exported for query call sites.
+		using Button = EventMouse::Button;
+
+		/// @brief Number of distinct key states tracked.
+		static constexpr auto KeyCount{static_cast<std::size_t>(Key::VolumeDown) + 1};
+		/// @brief Number of distinct mouse button states tracked.
+		static constexpr auto ButtonCount{static_cast<std::size_t>(Button::Middle) + 1};
+
+		/// @brief Construct the input service and subscribe to the event channels.
+		/// @param x Owning engine instance.
+		explicit Input(Engine& x) : Service{x}
+		{
+			engine().on_event_keyboard(
+				[this](const EventKeyboard& e)
+				{
+					const auto index = static_cast<std::size_t>(e.key);
+
+					switch (e.type)
+					{
+						case EventKeyboard::Type::KeyPressed:
+							if (!keys_down_.test(index))
+							{
+								keys_pressed_.set(index);
+							}
+
+							keys_down_.set(index);
+							break;
+						case EventKeyboard::Type::KeyReleased:
+							keys_down_.reset(index);
+							keys_released_.set(index);
+							break;
+						case EventKeyboard::Type::None:
+							break;
+					}
+				});
+
+			engine().on_event_mouse(
+				[this](const EventMouse& e)
+				{
+					const auto index = static_cast<std::size_t>(e.button);
+
+					switch (e.type)
+					{
+						case EventMouse::Type::ButtonPressed:
+							if (!buttons_down_.test(index))
+							{
+								buttons_pressed_.set(index);
+							}
+
+							buttons_down_.set(index);
+							break;
+						case EventMouse::Type::ButtonReleased:
+							buttons_down_.reset(index);
+							buttons_released_.set(index);
+							break;
+						case EventMouse::Type::Moved:
+							if (mouse_seen_)
+							{
+								mouse_delta_x_ += e.x - mouse_x_;
+								mouse_delta_y_ += e.y - mouse_y_;
+							}
+
+							mouse_x_ = e.x;
+							mouse_y_ = e.y;
+							mouse_seen_ = true;
+							break;
+						case EventMouse::Type::None:
+							break;
+					}
+				});
+		}
+
+		/// @brief Virtual destructor.
+		~Input() override = default;
+
+		Input(const Input&) = delete;
+		Input(Input&&) noexcept = delete;
+		auto operator=(const Input&) -> Input& = delete;
+		auto operator=(Input&&) noexcept -> Input& = delete;
+
+		/// @brief Get this service's display name.
+		/// @return Display name of the service.
+		[[nodiscard]] auto name() const -> std::string_view override
+		{
+			return "input";
+		}
+
+		/// @brief End-of-frame hook: retire this frame's edge state.
+		auto update_end() -> void override
+		{
+			keys_pressed_.reset();
+			keys_released_.reset();
+			buttons_pressed_.reset();
+			buttons_released_.reset();
+			mouse_delta_x_ = 0.0F;
+			mouse_delta_y_ = 0.0F;
+		}
+
+		/// @brief Test whether a key is currently held down.
+		/// @param x Key to query.
+		/// @return True while the key is down.
+		[[nodiscard]] auto is_down(Key x) const noexcept -> bool
+		{
+			return keys_down_.test(static_cast<std::size_t>(x));
+		}
+
+		/// @brief Test whether a key went down this frame.
+		/// @param x Key to query.
+		/// @return True only on the frame the key was pressed.
+		[[nodiscard]] auto is_pressed(Key x) const noexcept -> bool
+		{
+			return keys_pressed_.test(static_cast<std::size_t>(x));
+		}
+
+		/// @brief Test whether a key was released this frame.
+		/// @param x Key to query.
+		/// @return True only on the frame the key was released.
+		[[nodiscard]] auto is_released(Key x) const noexcept -> bool
+		{
+			return keys_released_.test(static_cast<std::size_t>(x));
+		}
+
+		/// @brief Test whether a mouse button is currently held down.
+		/// @param x Button to query.
+		/// @return True while the button is down.
+		[[nodiscard]] auto is_down(Button x) const noexcept -> bool
+		{
+			return buttons_down_.test(static_cast<std::size_t>(x));
+		}
+
+		/// @brief Test whether a mouse button went down this frame.
+		/// @param x Button to query.
+		/// @return True only on the frame the button was pressed.
+		[[nodiscard]] auto is_pressed(Button x) const noexcept -> bool
+		{
+			return buttons_pressed_.test(static_cast<std::size_t>(x));
+		}
+
+		/// @brief Test whether a mouse button was released this frame.
+		/// @param x Button to query.
+		/// @return True only on the frame the button was released.
+		[[nodiscard]] auto is_released(Button x) const noexcept -> bool
+		{
+			return buttons_released_.test(static_cast<std::size_t>(x));
+		}
+
+		/// @brief Get the cursor X-coordinate in window space.
+		/// @return Last reported cursor X-coordinate.
+		[[nodiscard]] auto mouse_x() const noexcept -> float
+		{
+			return mouse_x_;
+		}
+
+		/// @brief Get the cursor Y-coordinate in window space.
+		/// @return Last reported cursor Y-coordinate.
+		[[nodiscard]] auto mouse_y() const noexcept -> float
+		{
+			return mouse_y_;
+		}
+
+		/// @brief Get the cursor X-motion accumulated this frame.
+		/// @return Horizontal delta since last frame.
+		[[nodiscard]] auto mouse_delta_x() const noexcept -> float
+		{
+			return mouse_delta_x_;
+		}
+
+		/// @brief Get the cursor Y-motion accumulated this frame.
+		/// @return Vertical delta since last frame.
+		[[nodiscard]] auto mouse_delta_y() const noexcept -> float
+		{
+			return mouse_delta_y_;
+		}
+
+	private:
+		std::bitset<KeyCount> keys_down_;
+		std::bitset<KeyCount> keys_pressed_;
+		std::bitset<KeyCount> keys_released_;
+		std::bitset<ButtonCount> buttons_down_;
+		std::bitset<ButtonCount> buttons_pressed_;
+		std::bitset<ButtonCount> buttons_released_;
+		float mouse_x_{};
+		float mouse_y_{};
+		float mouse_delta_x_{};
+		float mouse_delta_y_{};
+		bool mouse_seen_{false};
+	};
+}
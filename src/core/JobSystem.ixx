@@ -0,0 +1,214 @@
+module;
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+export module druid.core.JobSystem;
+
+import druid.core.Signal;
+
+export namespace druid::core
+{
+	/// @class JobSystem
+	/// @brief Work-stealing thread pool for frame-scoped parallel work.
+	///
+	/// `JobSystem` owns a set of worker threads, each with its own job deque.
+	/// Submitted jobs are distributed round-robin across the workers; an idle
+	/// worker first drains its own deque and then steals from the front of the
+	/// other workers' deques, which keeps all cores busy under uneven loads.
+	///
+	/// Jobs are stored as small-buffer-optimized `Delegate` objects, so
+	/// submitting a lambda capturing a few pointers does not heap-allocate.
+	///
+	/// The intended usage is frame-scoped fan-out: submit a batch of
+	/// independent jobs and then call `wait()`, which has the calling thread
+	/// participate in execution until the batch is complete.
+	class JobSystem
+	{
+	public:
+		/// @brief Callable type executed by the job system.
+		using Job = Delegate<void()>;
+
+		/// @brief Construct the job system and start its worker threads.
+		/// @param threads Number of worker threads; defaults to the hardware concurrency.
+		explicit JobSystem(unsigned int threads = std::thread::hardware_concurrency())
+		{
+			const auto count = std::max(1U, threads);
+
+			for (auto i = 0U; i < count; i++)
+			{
+				queues_.emplace_back(std::make_unique<Queue>());
+			}
+
+			for (auto i = std::size_t{}; i < count; i++)
+			{
+				workers_.emplace_back([this, i] { worker(i); });
+			}
+		}
+
+		/// @brief Stop the workers and join them.
+		///
+		/// Jobs still queued at destruction are discarded.
+		~JobSystem()
+		{
+			{
+				const std::scoped_lock lock{mutex_};
+				stop_ = true;
+			}
+
+			available_.notify_all();
+
+			for (auto& worker : workers_)
+			{
+				worker.join();
+			}
+		}
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem(JobSystem&&) noexcept = delete;
+		auto operator=(const JobSystem&) -> JobSystem& = delete;
+		auto operator=(JobSystem&&) noexcept -> JobSystem& = delete;
+
+		/// @brief Submit a job for asynchronous execution.
+		/// @param x Callable to execute on a worker thread.
+		template <typename Callback>
+		auto submit(Callback&& x) -> void
+		{
+			pending_.fetch_add(1, std::memory_order_relaxed);
+
+			const auto index = next_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+
+			{
+				const std::scoped_lock lock{queues_[index]->mutex};
+				queues_[index]->jobs.emplace_back(std::forward<Callback>(x));
+			}
+
+			{
+				// Publish the count under the wait mutex: incrementing outside
+				// it could land between a worker's predicate check and its
+				// block, losing the wakeup with every worker asleep.
+				const std::scoped_lock lock{mutex_};
+				queued_.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			available_.notify_one();
+		}
+
+		/// @brief Block until all submitted jobs have completed.
+		///
+		/// The calling thread participates in job execution while waiting, so
+		/// a frame-level fan-out/wait never idles the submitting thread.
+		auto wait() -> void
+		{
+			while (pending_.load(std::memory_order_acquire) != 0)
+			{
+				Job job;
+
+				if (steal(queues_.size(), job))
+				{
+					job();
+					pending_.fetch_sub(1, std::memory_order_release);
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+
+		/// @brief Get the number of worker threads.
+		/// @return Worker thread count.
+		[[nodiscard]] auto thread_count() const noexcept -> std::size_t
+		{
+			return workers_.size();
+		}
+
+	private:
+		/// @brief Per-worker job deque.
+		struct Queue
+		{
+			std::mutex mutex;
+			std::deque<Job> jobs;
+		};
+
+		/// @brief Worker loop: drain the own deque, steal, or sleep.
+		auto worker(std::size_t index) -> void
+		{
+			while (true)
+			{
+				Job job;
+
+				if (pop(index, job) || steal(index, job))
+				{
+					job();
+					pending_.fetch_sub(1, std::memory_order_release);
+					continue;
+				}
+
+				std::unique_lock lock{mutex_};
+				available_.wait(lock, [this] { return stop_ || queued_.load(std::memory_order_acquire) != 0; });
+
+				if (stop_)
+				{
+					return;
+				}
+			}
+		}
+
+		/// @brief Pop a job from the back of a worker's own deque.
+		auto pop(std::size_t index, Job& job) -> bool
+		{
+			auto& queue = *queues_[index];
+			const std::scoped_lock lock{queue.mutex};
+
+			if (queue.jobs.empty())
+			{
+				return false;
+			}
+
+			job = std::move(queue.jobs.back());
+			queue.jobs.pop_back();
+			queued_.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+
+		/// @brief Steal a job from the front of any other worker's deque.
+		auto steal(std::size_t thief, Job& job) -> bool
+		{
+			for (auto offset = std::size_t{}; offset < queues_.size(); offset++)
+			{
+				const auto index = (thief + 1 + offset) % queues_.size();
+				auto& queue = *queues_[index];
+				const std::scoped_lock lock{queue.mutex};
+
+				if (queue.jobs.empty())
+				{
+					continue;
+				}
+
+				job = std::move(queue.jobs.front());
+				queue.jobs.pop_front();
+				queued_.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+
+			return false;
+		}
+
+		std::vector<std::unique_ptr<Queue>> queues_;
+		std::vector<std::thread> workers_;
+		std::mutex mutex_;
+		std::condition_variable available_;
+		std::atomic<std::size_t> pending_{};
+		std::atomic<std::size_t> queued_{};
+		std::atomic<std::size_t> next_{};
+		bool stop_{false};
+	};
+}
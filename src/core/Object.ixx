@@ -1,20 +1,126 @@
 module;
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <gsl/pointers>
+#include <iterator>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 export module druid.core.Object;
 
+import druid.core.Arena;
 import druid.core.Engine;
 import druid.core.Signal;
 
 export namespace druid::core
 {
+	/// @class StringInterner
+	/// @brief Process-wide table mapping object names to small integer ids.
+	///
+	/// Interning turns repeated name strings into 4-byte ids: objects store the
+	/// id instead of their own `std::string`, name equality becomes an integer
+	/// compare, and hashed child lookup keys on the id. Names commonly repeat
+	/// across instances (e.g., every "health_bar" in a UI), so interning also
+	/// shrinks per-object memory.
+	///
+	/// Ids are stable for the lifetime of the process; the table only grows.
+	class StringInterner
+	{
+	public:
+		/// @brief Id of the empty name.
+		static constexpr std::uint32_t Empty{0};
+		/// @brief Sentinel returned by `find` for names never interned.
+		static constexpr std::uint32_t Npos{0xFFFFFFFFU};
+
+		/// @brief Get the id for a name, interning it if new.
+		/// @param x Name to intern.
+		/// @return Stable id for the name.
+		[[nodiscard]] static auto intern(std::string_view x) -> std::uint32_t
+		{
+			auto& self = instance();
+			const std::scoped_lock lock{self.mutex_};
+			const auto it = self.ids_.find(x);
+
+			if (it != self.ids_.end())
+			{
+				return it->second;
+			}
+
+			const auto id = static_cast<std::uint32_t>(self.strings_.size());
+			const auto inserted = self.ids_.emplace(std::string{x}, id).first;
+			self.strings_.push_back(&inserted->first);
+			return id;
+		}
+
+		/// @brief Look up the id for a name without interning it.
+		/// @param x Name to look up.
+		/// @return The name's id, or `Npos` if it was never interned.
+		[[nodiscard]] static auto find(std::string_view x) -> std::uint32_t
+		{
+			auto& self = instance();
+			const std::scoped_lock lock{self.mutex_};
+			const auto it = self.ids_.find(x);
+			return it != self.ids_.end() ? it->second : Npos;
+		}
+
+		/// @brief Get the name string for an id.
+		/// @param x Id to resolve.
+		/// @return View of the interned name; empty for unknown ids.
+		[[nodiscard]] static auto view(std::uint32_t x) -> std::string_view
+		{
+			auto& self = instance();
+			const std::scoped_lock lock{self.mutex_};
+			return x < self.strings_.size() ? std::string_view{*self.strings_[x]} : std::string_view{};
+		}
+
+	private:
+		/// @brief Transparent hash so lookups accept string views without copying.
+		struct Hash
+		{
+			using is_transparent = void;
+
+			[[nodiscard]] auto operator()(std::string_view x) const noexcept -> std::size_t
+			{
+				return std::hash<std::string_view>{}(x);
+			}
+		};
+
+		/// @brief Transparent equality matching the transparent hash.
+		struct Equal
+		{
+			using is_transparent = void;
+
+			[[nodiscard]] auto operator()(std::string_view a, std::string_view b) const noexcept -> bool
+			{
+				return a == b;
+			}
+		};
+
+		StringInterner()
+		{
+			const auto inserted = ids_.emplace(std::string{}, Empty).first;
+			strings_.push_back(&inserted->first);
+		}
+
+		[[nodiscard]] static auto instance() -> StringInterner&
+		{
+			static StringInterner self;
+			return self;
+		}
+
+		std::unordered_map<std::string, std::uint32_t, Hash, Equal> ids_;
+		std::vector<const std::string*> strings_;
+		std::mutex mutex_;
+	};
+
 	class Object;
 
 	/// @concept ObjectType
@@ -22,6 +128,22 @@ export namespace druid::core
 	template <typename T>
 	concept ObjectType = std::is_base_of_v<Object, T>;
 
+	/// @struct ObjectDeleter
+	/// @brief Deleter that knows whether an object lives in an arena.
+	///
+	/// Heap-allocated objects are deleted normally; arena-allocated objects
+	/// only have their destructor run — the storage is reclaimed wholesale
+	/// when the arena itself is destroyed.
+	struct ObjectDeleter
+	{
+		Arena* arena{};
+
+		auto operator()(Object* x) const noexcept -> void;
+	};
+
+	/// @brief Owning pointer to an object, heap- or arena-backed.
+	using ObjectPtr = std::unique_ptr<Object, ObjectDeleter>;
+
 	/// @class Object
 	/// @brief Base class for all hierarchical objects in the Druid engine.
 	///
@@ -56,22 +178,37 @@ export namespace druid::core
 		auto operator=(Object&&) noexcept -> Object& = delete;
 
 		/// @brief Assign an identifying name to this object.
+		///
+		/// The name is interned; the object stores only the resulting id.
+		///
 		/// @param x The given name to assign to this object.
 		auto set_name(std::string_view x) -> void
 		{
-			this->name_ = x;
+			this->name_id_ = StringInterner::intern(x);
+
+			if (parent_ != nullptr)
+			{
+				parent_->child_index_dirty_ = true;
+			}
 		}
 
 		/// @brief Get the name assigned to this object.
 		/// @return The name assigned to this object.
 		[[nodiscard]] auto get_name() const noexcept -> std::string_view
 		{
-			return this->name_;
+			return StringInterner::view(name_id_);
+		}
+
+		/// @brief Get the interned id of this object's name.
+		/// @return Interned name id.
+		[[nodiscard]] auto get_name_id() const noexcept -> std::uint32_t
+		{
+			return name_id_;
 		}
 
 		/// @brief Add the given object as a child of this object.
 		/// @param x The given object to add as a child.
-		auto add_child(std::unique_ptr<Object> x) -> void
+		auto add_child(ObjectPtr x) -> void
 		{
 			if (x == nullptr)
 			{
@@ -79,24 +216,40 @@ export namespace druid::core
 			}
 
 			x->parent_ = this;
+
+			if (x->arena_ == nullptr)
+			{
+				x->arena_ = arena_;
+			}
+
 			auto& child = children_.emplace_back(std::move(x));
+			child_index_dirty_ = true;
 			child->on_added_(this);
 			on_child_added_(child.get());
 		}
 
+		/// @brief Add a heap-allocated object as a child of this object.
+		/// @param x The given object to add as a child.
+		auto add_child(std::unique_ptr<Object> x) -> void
+		{
+			add_child(ObjectPtr{x.release(), ObjectDeleter{}});
+		}
+
 		/// @brief Create an object as a child of this object and return a reference to it.
 		/// @param x The given name to assign to this object.
 		/// @return The reference to the created child.
 		[[nodiscard]] auto create_child(std::string_view x = {}) -> Object&
 		{
-			auto child = std::make_unique<Object>(engine());
-			child->set_name(x);
-			auto* ptr = child.get();
-			add_child(std::move(child));
-			return *ptr;
+			auto& child = create_child<Object>(engine());
+			child.set_name(x);
+			return child;
 		}
 
 		/// @brief Create an object of type T as a child of this object and return a reference to it.
+		///
+		/// When this tree has an arena (see `set_arena`), the child is
+		/// constructed in arena storage; otherwise it is heap-allocated.
+		///
 		/// @tparam ...Args The constructor argument types of T.
 		/// @tparam T The type of object to create. Must inherit from Object.
 		/// @param ...args The constructor arguments to forward to T's constructor.
@@ -104,6 +257,13 @@ export namespace druid::core
 		template <ObjectType T, typename... Args>
 		[[nodiscard]] auto create_child(Args&&... args) -> T&
 		{
+			if (arena_ != nullptr)
+			{
+				auto* ptr = arena_->create<T>(std::forward<Args>(args)...);
+				add_child(ObjectPtr{ptr, ObjectDeleter{.arena = arena_}});
+				return *ptr;
+			}
+
 			auto child = std::make_unique<T>(std::forward<Args>(args)...);
 			auto* ptr = child.get();
 			add_child(std::move(child));
@@ -111,8 +271,8 @@ export namespace druid::core
 		}
 
 		/// @brief Remove this object from its parent if it has one.
-		/// @return Return the owning unique_ptr of this object.
-		[[nodiscard]] auto remove() -> std::unique_ptr<Object>
+		/// @return Return the owning pointer of this object.
+		[[nodiscard]] auto remove() -> ObjectPtr
 		{
 			if (parent_ == nullptr)
 			{
@@ -130,6 +290,46 @@ export namespace druid::core
 			auto* parent = parent_;
 			parent_ = nullptr;
 			parent->children_.erase(it);
+			parent->child_index_dirty_ = true;
+			parent->on_child_removed_(child.get());
+			on_removed_(parent);
+			return child;
+		}
+
+		/// @brief Detach this object from its parent without preserving sibling order.
+		///
+		/// Swap-and-pop variant of `remove`: the last sibling takes this
+		/// object's slot, so no elements shift — bulk despawns detach in
+		/// constant time per object regardless of child count. Use `remove`
+		/// when sibling order matters. Pair with a `DestructionQueue` to also
+		/// defer the subtree's teardown out of the frame.
+		///
+		/// @return The owning pointer of this object, or nullptr if no parent.
+		[[nodiscard]] auto detach() -> ObjectPtr
+		{
+			if (parent_ == nullptr)
+			{
+				return nullptr;
+			}
+
+			auto it = std::ranges::find_if(parent_->children_, [this](const auto& o) -> auto { return this == o.get(); });
+
+			if (it == std::end(parent_->children_))
+			{
+				return nullptr;
+			}
+
+			auto child = std::move(*it);
+			auto* parent = parent_;
+			parent_ = nullptr;
+
+			if (std::next(it) != std::end(parent->children_))
+			{
+				*it = std::move(parent->children_.back());
+			}
+
+			parent->children_.pop_back();
+			parent->child_index_dirty_ = true;
 			parent->on_child_removed_(child.get());
 			on_removed_(parent);
 			return child;
@@ -137,24 +337,92 @@ export namespace druid::core
 
 		/// @brief Get the list of children this object owns.
 		/// @return The, read-only, list of children.
-		[[nodiscard]] auto children() const noexcept -> const std::vector<std::unique_ptr<Object>>&
+		[[nodiscard]] auto children() const noexcept -> const std::vector<ObjectPtr>&
 		{
 			return children_;
 		}
 
+		/// @brief Back this tree's child allocations with an arena.
+		///
+		/// Children created through `create_child` after this call are
+		/// constructed in arena slabs and inherit the arena for their own
+		/// children. The arena must outlive the subtree.
+		///
+		/// @param x Arena to allocate children from, or nullptr to revert to the heap.
+		auto set_arena(Arena* x) noexcept -> void
+		{
+			arena_ = x;
+		}
+
+		/// @brief Get the arena backing this tree's child allocations.
+		/// @return The arena, or nullptr when children are heap-allocated.
+		[[nodiscard]] auto get_arena() const noexcept -> Arena*
+		{
+			return arena_;
+		}
+
 		/// @brief Find a child with the given name.
+		///
+		/// Resolution is a hash lookup over an index keyed by interned name id,
+		/// rebuilt lazily after the children or their names change. A name that
+		/// was never interned anywhere cannot match and returns immediately.
+		/// When several children share a name, the first in child order is
+		/// returned.
+		///
 		/// @param x The name to search this object's children for.
 		/// @return The object whose name matches the given name.
 		[[nodiscard]] auto find_child(std::string_view x) const -> Object*
 		{
-			const auto it = std::ranges::find_if(children_, [x](auto& o) -> auto { return x == o->get_name(); });
+			const auto id = StringInterner::find(x);
 
-			if (it == std::end(children_))
+			if (id == StringInterner::Npos)
 			{
 				return nullptr;
 			}
 
-			return (*it).get();
+			if (child_index_dirty_)
+			{
+				child_index_.clear();
+
+				for (const auto& child : children_)
+				{
+					child_index_.emplace(child->name_id_, child.get());
+				}
+
+				child_index_dirty_ = false;
+			}
+
+			const auto it = child_index_.find(id);
+			return it != child_index_.end() ? it->second : nullptr;
+		}
+
+		/// @brief Find a descendant by a separator-delimited name path.
+		///
+		/// Each path segment is resolved with `find_child`, so the whole walk
+		/// is O(path length) hash lookups (e.g., "hud/health/label").
+		///
+		/// @param x Name path relative to this object.
+		/// @param separator Character separating path segments.
+		/// @return The object at the path, or nullptr if any segment is missing.
+		[[nodiscard]] auto find_descendant(std::string_view x, char separator = '/') const -> Object*
+		{
+			const auto* current = this;
+			Object* found = nullptr;
+
+			for (std::size_t begin = 0;;)
+			{
+				const auto end = x.find(separator, begin);
+				const auto segment = x.substr(begin, end == std::string_view::npos ? std::string_view::npos : end - begin);
+				found = current->find_child(segment);
+
+				if (found == nullptr || end == std::string_view::npos)
+				{
+					return found;
+				}
+
+				current = found;
+				begin = end + 1;
+			}
 		}
 
 		/// @brief Returns a pointer to the parent object.
@@ -241,9 +509,12 @@ export namespace druid::core
 		}
 
 	private:
-		std::vector<std::unique_ptr<Object>> children_;
-		std::string name_;
+		std::vector<ObjectPtr> children_;
+		mutable std::unordered_map<std::uint32_t, Object*> child_index_;
+		mutable bool child_index_dirty_{false};
+		std::uint32_t name_id_{StringInterner::Empty};
 		Object* parent_{};
+		Arena* arena_{};
 		gsl::strict_not_null<Engine*> engine_;
 
 		Signal<void()> on_destroyed_;
@@ -252,4 +523,15 @@ export namespace druid::core
 		Signal<void(Object*)> on_child_added_;
 		Signal<void(Object*)> on_child_removed_;
 	};
+
+	inline auto ObjectDeleter::operator()(Object* x) const noexcept -> void
+	{
+		if (arena != nullptr)
+		{
+			x->~Object();
+			return;
+		}
+
+		delete x; // NOLINT (cppcoreguidelines-owning-memory)
+	}
 }
@@ -0,0 +1,204 @@
+module;
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifndef DRUID_PROFILE
+	#define DRUID_PROFILE 1
+#endif
+
+export module druid.core.Profiler;
+
+export namespace druid::core
+{
+	/// @class Profiler
+	/// @brief Per-frame scoped-timer accumulator for engine instrumentation.
+	///
+	/// The profiler owns a set of named slots; a `Scope` measures one timed
+	/// section and folds its duration into the slot's per-frame accumulator
+	/// (total, call count, min, max). At the start of each frame the engine
+	/// snapshots the accumulators, so `samples()` always describes the last
+	/// completed frame — the one a long-frame investigation asks about.
+	///
+	/// Instrumentation is governed by the compile-time `Enabled` flag (the
+	/// `DRUID_PROFILE` definition, see the `BUILD_ENABLE_PROFILING` option):
+	/// when disabled, scopes never read the clock and recording compiles to
+	/// nothing, so the hooks can stay in production builds.
+	///
+	/// `report()` renders the snapshot as text, e.g. for an on-screen overlay
+	/// through `NodeText::set_text`.
+	class Profiler
+	{
+	public:
+		/// @brief Compile-time master switch for instrumentation.
+		static constexpr bool Enabled{DRUID_PROFILE != 0};
+
+		/// @struct Sample
+		/// @brief Accumulated timings of one slot over one frame.
+		struct Sample
+		{
+			/// @brief Slot name, e.g. "window[2]::update".
+			std::string name;
+			/// @brief Sum of all scope durations this frame.
+			std::chrono::steady_clock::duration total{};
+			/// @brief Shortest single scope this frame.
+			std::chrono::steady_clock::duration min{};
+			/// @brief Longest single scope this frame.
+			std::chrono::steady_clock::duration max{};
+			/// @brief Number of scopes recorded this frame.
+			std::uint32_t count{};
+		};
+
+		/// @class Scope
+		/// @brief RAII timer recording into one profiler slot on destruction.
+		class Scope
+		{
+		public:
+			/// @brief Start timing a section.
+			/// @param x Profiler to record into.
+			/// @param slot Slot index obtained from `Profiler::slot`.
+			Scope(Profiler& x, std::size_t slot)
+			{
+				if constexpr (Enabled)
+				{
+					profiler_ = &x;
+					slot_ = slot;
+					start_ = std::chrono::steady_clock::now();
+				}
+			}
+
+			/// @brief Stop timing and record the elapsed duration.
+			~Scope()
+			{
+				if constexpr (Enabled)
+				{
+					profiler_->record(slot_, std::chrono::steady_clock::now() - start_);
+				}
+			}
+
+			Scope(const Scope&) = delete;
+			Scope(Scope&&) noexcept = delete;
+			auto operator=(const Scope&) -> Scope& = delete;
+			auto operator=(Scope&&) noexcept -> Scope& = delete;
+
+		private:
+			Profiler* profiler_{};
+			std::size_t slot_{};
+			std::chrono::steady_clock::time_point start_;
+		};
+
+		/// @brief Find or create the slot with the given name.
+		///
+		/// Intended for setup paths: resolution is a linear name scan, so
+		/// callers should cache the returned index and reuse it per frame.
+		///
+		/// @param x Slot name.
+		/// @return Index of the slot, stable for the profiler's lifetime.
+		[[nodiscard]] auto slot(std::string_view x) -> std::size_t
+		{
+			for (std::size_t i = 0; i < current_.size(); i++)
+			{
+				if (current_[i].name == x)
+				{
+					return i;
+				}
+			}
+
+			current_.push_back({.name = std::string{x}});
+			frame_.push_back({.name = std::string{x}});
+			return current_.size() - 1;
+		}
+
+		/// @brief Open a scoped timer on a slot.
+		/// @param x Slot index obtained from `slot`.
+		/// @return RAII scope recording on destruction.
+		[[nodiscard]] auto scope(std::size_t x) -> Scope
+		{
+			return Scope{*this, x};
+		}
+
+		/// @brief Fold one measured duration into a slot's accumulator.
+		/// @param x Slot index.
+		/// @param duration Measured duration.
+		auto record(std::size_t x, std::chrono::steady_clock::duration duration) -> void
+		{
+			if constexpr (!Enabled)
+			{
+				return;
+			}
+
+			auto& sample = current_[x];
+			sample.min = sample.count == 0 ? duration : std::min(sample.min, duration);
+			sample.max = sample.count == 0 ? duration : std::max(sample.max, duration);
+			sample.total += duration;
+			sample.count++;
+		}
+
+		/// @brief Snapshot the accumulators and start a new frame.
+		///
+		/// Called by the engine at the top of each frame; `samples()` then
+		/// reports the frame that just completed.
+		auto begin_frame() -> void
+		{
+			if constexpr (!Enabled)
+			{
+				return;
+			}
+
+			for (std::size_t i = 0; i < current_.size(); i++)
+			{
+				frame_[i].total = current_[i].total;
+				frame_[i].min = current_[i].min;
+				frame_[i].max = current_[i].max;
+				frame_[i].count = current_[i].count;
+
+				current_[i].total = {};
+				current_[i].min = {};
+				current_[i].max = {};
+				current_[i].count = 0;
+			}
+		}
+
+		/// @brief Get the last completed frame's samples.
+		/// @return One sample per slot, in slot order.
+		[[nodiscard]] auto samples() const noexcept -> std::span<const Sample>
+		{
+			return frame_;
+		}
+
+		/// @brief Render the last frame's samples as display text.
+		///
+		/// One line per slot that recorded anything, suitable for an overlay
+		/// (e.g. `NodeText::set_text(profiler.report())`).
+		///
+		/// @return Formatted report; empty when nothing was recorded.
+		[[nodiscard]] auto report() const -> std::string
+		{
+			std::string text;
+
+			for (const auto& sample : frame_)
+			{
+				if (sample.count == 0)
+				{
+					continue;
+				}
+
+				const auto milliseconds = std::chrono::duration<double, std::milli>{sample.total}.count();
+				text += std::format("{}: {:.3f} ms (x{})\n", sample.name, milliseconds, sample.count);
+			}
+
+			return text;
+		}
+
+	private:
+		std::vector<Sample> current_;
+		std::vector<Sample> frame_;
+	};
+}
@@ -0,0 +1,507 @@
+module;
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+export module druid.core.Registry;
+
+export namespace druid::core
+{
+	/// @struct Entity
+	/// @brief Lightweight handle identifying an entity in a Registry.
+	///
+	/// An entity is an index into the registry's bookkeeping plus a version
+	/// counter. The version is bumped when the index is recycled so stale
+	/// handles can be detected with `Registry::valid`.
+	struct Entity
+	{
+		/// @brief Slot index within the owning registry.
+		std::uint32_t index{};
+		/// @brief Version counter used to detect recycled slots.
+		std::uint32_t version{};
+
+		[[nodiscard]] constexpr auto operator==(const Entity&) const noexcept -> bool = default;
+	};
+
+	/// @class Registry
+	/// @brief Archetype-based entity/component storage with structure-of-arrays layout.
+	///
+	/// The registry groups entities by their exact component set (their
+	/// *archetype*). Each archetype stores one densely packed contiguous array
+	/// per component type, so iterating all entities with a given component set
+	/// is a linear walk over a handful of vectors rather than a pointer chase
+	/// through a heap-allocated object tree. This realizes the ECS storage side
+	/// of ADR 0001.
+	///
+	/// Typical usage:
+	/// @code
+	/// Registry registry;
+	/// auto e = registry.create();
+	/// registry.emplace<Position>(e, 1.0F, 2.0F);
+	/// registry.emplace<Scale>(e);
+	///
+	/// for (auto [pos, scale] : registry.view<Position, Scale>())
+	/// {
+	///     pos.x += scale.x;
+	/// }
+	/// @endcode
+	///
+	/// @note Adding or removing a component moves the entity's row between
+	///       archetypes; component references obtained earlier are invalidated
+	///       by any structural change.
+	class Registry
+	{
+	public:
+		/// @brief Typed iteration over all entities holding a set of components.
+		///
+		/// A `View` snapshots the matching archetypes at creation time and
+		/// iterates their packed component arrays archetype by archetype,
+		/// yielding a tuple of component references per entity.
+		///
+		/// @tparam Ts Component types every yielded entity must hold.
+		template <typename... Ts>
+		class View
+		{
+		public:
+			/// @brief One matching archetype's component arrays.
+			struct Match
+			{
+				/// @brief Pointer to each component's packed storage.
+				std::tuple<std::vector<Ts>*...> columns;
+				/// @brief Number of rows (entities) in this archetype.
+				std::size_t size{};
+			};
+
+			/// @brief Forward iterator yielding `std::tuple<Ts&...>` per entity.
+			class Iterator
+			{
+			public:
+				Iterator(const std::vector<Match>* x, std::size_t match) : matches_{x}, match_{match}
+				{
+					skip_empty();
+				}
+
+				[[nodiscard]] auto operator*() const -> std::tuple<Ts&...>
+				{
+					const auto& match = (*matches_)[match_];
+					return {(*std::get<std::vector<Ts>*>(match.columns))[row_]...};
+				}
+
+				auto operator++() -> Iterator&
+				{
+					row_++;
+
+					if (row_ >= (*matches_)[match_].size)
+					{
+						row_ = 0;
+						match_++;
+						skip_empty();
+					}
+
+					return *this;
+				}
+
+				[[nodiscard]] auto operator==(const Iterator& x) const noexcept -> bool
+				{
+					return match_ == x.match_ && row_ == x.row_;
+				}
+
+			private:
+				auto skip_empty() -> void
+				{
+					while (match_ < matches_->size() && (*matches_)[match_].size == 0)
+					{
+						match_++;
+					}
+				}
+
+				const std::vector<Match>* matches_{};
+				std::size_t match_{};
+				std::size_t row_{};
+			};
+
+			explicit View(std::vector<Match> x) : matches_{std::move(x)}
+			{
+			}
+
+			[[nodiscard]] auto begin() const -> Iterator
+			{
+				return {&matches_, 0};
+			}
+
+			[[nodiscard]] auto end() const -> Iterator
+			{
+				return {&matches_, matches_.size()};
+			}
+
+		private:
+			std::vector<Match> matches_;
+		};
+
+		/// @brief Construct an empty registry.
+		///
+		/// The registry always owns one archetype with no components, which
+		/// holds freshly created entities.
+		Registry()
+		{
+			archetypes_.emplace_back(std::make_unique<Archetype>());
+		}
+
+		/// @brief Get the unique id assigned to a component type.
+		///
+		/// Ids are assigned on first use and are stable for the lifetime of the
+		/// process.
+		///
+		/// @tparam T Component type.
+		/// @return The id assigned to T.
+		template <typename T>
+		[[nodiscard]] static auto component_id() -> std::size_t
+		{
+			static const auto id = next_component_id();
+			return id;
+		}
+
+		/// @brief Create a new entity with no components.
+		/// @return Handle to the created entity.
+		[[nodiscard]] auto create() -> Entity
+		{
+			auto index = std::uint32_t{};
+
+			if (!free_.empty())
+			{
+				index = free_.back();
+				free_.pop_back();
+			}
+			else
+			{
+				index = static_cast<std::uint32_t>(records_.size());
+				records_.emplace_back();
+			}
+
+			auto& record = records_[index];
+			record.archetype = 0;
+			record.alive = true;
+
+			const Entity entity{.index = index, .version = record.version};
+			auto& empty = *archetypes_.front();
+			record.row = static_cast<std::uint32_t>(empty.entities.size());
+			empty.entities.push_back(entity);
+			return entity;
+		}
+
+		/// @brief Destroy an entity and all of its components.
+		///
+		/// The entity's row is swap-removed from its archetype and the handle's
+		/// slot is recycled with a bumped version.
+		///
+		/// @param x Entity to destroy. Invalid handles are ignored.
+		auto destroy(Entity x) -> void
+		{
+			if (!valid(x))
+			{
+				return;
+			}
+
+			auto& record = records_[x.index];
+			auto& archetype = *archetypes_[record.archetype];
+
+			for (auto& column : archetype.columns)
+			{
+				column->swap_remove(record.row);
+			}
+
+			swap_remove_entity(archetype, record.row);
+
+			record.alive = false;
+			record.version++;
+			free_.push_back(x.index);
+		}
+
+		/// @brief Tells whether an entity handle refers to a live entity.
+		/// @param x Entity handle to check.
+		/// @return True if the handle is valid and the entity is alive.
+		[[nodiscard]] auto valid(Entity x) const noexcept -> bool
+		{
+			return x.index < records_.size() && records_[x.index].version == x.version && records_[x.index].alive;
+		}
+
+		/// @brief Add a component to an entity, constructing it in place.
+		///
+		/// The entity is moved to the archetype holding its new component set.
+		/// If the entity already holds a component of type T, that component is
+		/// replaced.
+		///
+		/// @tparam T Component type to add.
+		/// @tparam Args Constructor argument types for T.
+		/// @param x Target entity. Must be valid.
+		/// @param args Arguments forwarded to T's constructor.
+		/// @return Reference to the stored component.
+		template <typename T, typename... Args>
+		auto emplace(Entity x, Args&&... args) -> T&
+		{
+			const auto id = component_id<T>();
+			auto& record = records_[x.index];
+			auto& src = *archetypes_[record.archetype];
+
+			if (src.index_of(id) != Archetype::Npos)
+			{
+				auto& column = static_cast<Column<T>&>(*src.columns[src.index_of(id)]);
+				column.data[record.row] = T{std::forward<Args>(args)...};
+				return column.data[record.row];
+			}
+
+			auto key = src.key;
+			key.insert(std::ranges::lower_bound(key, id), id);
+
+			auto& dst = find_or_create_archetype<T>(key, src, id);
+			move_row(src, dst, record);
+
+			auto& column = static_cast<Column<T>&>(*dst.columns[dst.index_of(id)]);
+			column.data.emplace_back(std::forward<Args>(args)...);
+			return column.data.back();
+		}
+
+		/// @brief Remove a component from an entity.
+		///
+		/// The entity is moved to the archetype holding its reduced component
+		/// set. A missing component is ignored.
+		///
+		/// @tparam T Component type to remove.
+		/// @param x Target entity. Must be valid.
+		template <typename T>
+		auto remove(Entity x) -> void
+		{
+			const auto id = component_id<T>();
+			auto& record = records_[x.index];
+			auto& src = *archetypes_[record.archetype];
+			const auto column = src.index_of(id);
+
+			if (column == Archetype::Npos)
+			{
+				return;
+			}
+
+			auto key = src.key;
+			key.erase(std::ranges::find(key, id));
+
+			auto& dst = find_or_create_archetype<T>(key, src, Archetype::Npos);
+			const auto row = record.row;
+			move_row(src, dst, record, id);
+			src.columns[column]->swap_remove(row);
+		}
+
+		/// @brief Tells whether an entity holds a component of type T.
+		/// @tparam T Component type to query.
+		/// @param x Target entity. Must be valid.
+		/// @return True if the component is present.
+		template <typename T>
+		[[nodiscard]] auto has(Entity x) const -> bool
+		{
+			const auto& record = records_[x.index];
+			return archetypes_[record.archetype]->index_of(component_id<T>()) != Archetype::Npos;
+		}
+
+		/// @brief Get a pointer to an entity's component of type T.
+		/// @tparam T Component type to access.
+		/// @param x Target entity. Must be valid.
+		/// @return Pointer to the component, or nullptr if the entity does not hold one.
+		template <typename T>
+		[[nodiscard]] auto get(Entity x) -> T*
+		{
+			auto& record = records_[x.index];
+			auto& archetype = *archetypes_[record.archetype];
+			const auto column = archetype.index_of(component_id<T>());
+
+			if (column == Archetype::Npos)
+			{
+				return nullptr;
+			}
+
+			return &static_cast<Column<T>&>(*archetype.columns[column]).data[record.row];
+		}
+
+		/// @brief Create a view over all entities holding the given components.
+		///
+		/// @tparam Ts Component types every yielded entity must hold.
+		/// @return View iterating matching entities as tuples of component references.
+		template <typename... Ts>
+		[[nodiscard]] auto view() -> View<Ts...>
+		{
+			typename View<Ts...>::Match match;
+			std::vector<typename View<Ts...>::Match> matches;
+
+			for (auto& archetype : archetypes_)
+			{
+				if (((archetype->index_of(component_id<Ts>()) != Archetype::Npos) && ...))
+				{
+					match.columns = {&static_cast<Column<Ts>&>(*archetype->columns[archetype->index_of(component_id<Ts>())]).data...};
+					match.size = archetype->entities.size();
+					matches.push_back(match);
+				}
+			}
+
+			return View<Ts...>{std::move(matches)};
+		}
+
+	private:
+		/// @brief Type-erased interface over one component's packed storage.
+		struct ColumnBase
+		{
+			ColumnBase() = default;
+			virtual ~ColumnBase() = default;
+			ColumnBase(const ColumnBase&) = delete;
+			ColumnBase(ColumnBase&&) noexcept = delete;
+			auto operator=(const ColumnBase&) -> ColumnBase& = delete;
+			auto operator=(ColumnBase&&) noexcept -> ColumnBase& = delete;
+
+			/// @brief Create an empty column of the same component type.
+			[[nodiscard]] virtual auto clone_empty() const -> std::unique_ptr<ColumnBase> = 0;
+			/// @brief Move one row's value to the end of another column of the same type.
+			virtual auto move_append(std::size_t row, ColumnBase& dst) -> void = 0;
+			/// @brief Remove a row by swapping the last row into its place.
+			virtual auto swap_remove(std::size_t row) -> void = 0;
+		};
+
+		/// @brief Packed storage for one component type within an archetype.
+		template <typename T>
+		struct Column final : ColumnBase
+		{
+			[[nodiscard]] auto clone_empty() const -> std::unique_ptr<ColumnBase> override
+			{
+				return std::make_unique<Column<T>>();
+			}
+
+			auto move_append(std::size_t row, ColumnBase& dst) -> void override
+			{
+				static_cast<Column<T>&>(dst).data.push_back(std::move(data[row]));
+			}
+
+			auto swap_remove(std::size_t row) -> void override
+			{
+				if (row + 1 < data.size())
+				{
+					data[row] = std::move(data.back());
+				}
+
+				data.pop_back();
+			}
+
+			std::vector<T> data;
+		};
+
+		/// @brief One component-set group: parallel packed arrays plus row-to-entity mapping.
+		struct Archetype
+		{
+			static constexpr auto Npos = static_cast<std::size_t>(-1);
+
+			/// @brief Find the column index of a component id within this archetype.
+			[[nodiscard]] auto index_of(std::size_t id) const noexcept -> std::size_t
+			{
+				const auto it = std::ranges::lower_bound(key, id);
+				return (it != key.end() && *it == id) ? static_cast<std::size_t>(it - key.begin()) : Npos;
+			}
+
+			/// @brief Sorted component ids stored by this archetype.
+			std::vector<std::size_t> key;
+			/// @brief One packed column per component id, parallel to `key`.
+			std::vector<std::unique_ptr<ColumnBase>> columns;
+			/// @brief Entity handle stored in each row.
+			std::vector<Entity> entities;
+		};
+
+		/// @brief Per-entity bookkeeping record.
+		struct Record
+		{
+			std::uint32_t archetype{};
+			std::uint32_t row{};
+			std::uint32_t version{};
+			bool alive{};
+		};
+
+		[[nodiscard]] static auto next_component_id() -> std::size_t
+		{
+			static std::size_t id{};
+			return id++;
+		}
+
+		/// @brief Find the archetype with the given key, creating it from `src` if missing.
+		///
+		/// When creating, columns are cloned empty from `src`; the column for
+		/// `added` (when not `Npos`) is created as a typed Column<T>.
+		template <typename T>
+		[[nodiscard]] auto find_or_create_archetype(const std::vector<std::size_t>& key, const Archetype& src, std::size_t added) -> Archetype&
+		{
+			for (auto& archetype : archetypes_)
+			{
+				if (archetype->key == key)
+				{
+					return *archetype;
+				}
+			}
+
+			auto archetype = std::make_unique<Archetype>();
+			archetype->key = key;
+
+			for (const auto id : key)
+			{
+				if (id == added)
+				{
+					archetype->columns.emplace_back(std::make_unique<Column<T>>());
+				}
+				else
+				{
+					archetype->columns.emplace_back(src.columns[src.index_of(id)]->clone_empty());
+				}
+			}
+
+			return *archetypes_.emplace_back(std::move(archetype));
+		}
+
+		/// @brief Move an entity's row from `src` to `dst`, excluding `skip` (if any).
+		///
+		/// Updates the record of the moved entity and of the entity swapped into
+		/// the vacated row.
+		auto move_row(Archetype& src, Archetype& dst, Record& record, std::size_t skip = Archetype::Npos) -> void
+		{
+			const auto row = record.row;
+
+			for (std::size_t i = 0; i < src.key.size(); i++)
+			{
+				if (src.key[i] == skip)
+				{
+					continue;
+				}
+
+				src.columns[i]->move_append(row, *dst.columns[dst.index_of(src.key[i])]);
+				src.columns[i]->swap_remove(row);
+			}
+
+			const auto entity = src.entities[row];
+			swap_remove_entity(src, row);
+
+			record.archetype = static_cast<std::uint32_t>(std::ranges::find_if(archetypes_, [&dst](const auto& a) { return a.get() == &dst; }) - archetypes_.begin());
+			record.row = static_cast<std::uint32_t>(dst.entities.size());
+			dst.entities.push_back(entity);
+		}
+
+		/// @brief Swap-remove a row's entity mapping, fixing the swapped record.
+		auto swap_remove_entity(Archetype& archetype, std::size_t row) -> void
+		{
+			if (row + 1 < archetype.entities.size())
+			{
+				archetype.entities[row] = archetype.entities.back();
+				records_[archetype.entities[row].index].row = static_cast<std::uint32_t>(row);
+			}
+
+			archetype.entities.pop_back();
+		}
+
+		std::vector<std::unique_ptr<Archetype>> archetypes_;
+		std::vector<Record> records_;
+		std::vector<std::uint32_t> free_;
+	};
+}
@@ -1,11 +1,202 @@
 module;
 
-#include <functional>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 export module druid.core.Signal;
 
 export namespace druid::core
 {
+	/// @brief Primary template declaration for Delegate.
+	///
+	/// This primary template is intentionally left undefined and is specialized
+	/// for function-signature types of the form `R(Args...)`.
+	///
+	/// @tparam T Function-signature type (e.g., `void(int, float)`).
+	/// @note Only the specialization for function types is valid.
+	template <typename T>
+	class Delegate;
+
+	/// @brief Small-buffer-optimized move-only callable wrapper.
+	///
+	/// @tparam R Return type of the delegate invocation.
+	/// @tparam Args Argument types accepted by the delegate.
+	///
+	/// `Delegate` stores callables whose size fits within `BufferSize` directly
+	/// inline, so connecting a lambda that captures a few pointers never touches
+	/// the heap. Larger callables fall back to a single heap allocation. Dispatch
+	/// is a single indirect call through a stored function pointer, with no
+	/// virtual table or RTTI involvement.
+	///
+	/// This type exists so `Signal` emission can be a tight loop over
+	/// contiguously stored, inline callables rather than a chain of
+	/// `std::function` indirections.
+	template <typename R, typename... Args>
+	class Delegate<R(Args...)>
+	{
+	public:
+		/// @brief Size in bytes of the inline callable storage.
+		///
+		/// Sized for a capturing lambda of a few pointers; anything larger is
+		/// heap-allocated transparently.
+		static constexpr std::size_t BufferSize = sizeof(void*) * 4;
+
+		/// @brief Construct an empty delegate.
+		Delegate() noexcept = default;
+
+		/// @brief Construct a delegate from a callable.
+		///
+		/// The callable is stored inline when it fits within `BufferSize` and is
+		/// nothrow move constructible; otherwise it is stored on the heap.
+		///
+		/// @tparam Callback Callable type compatible with `R(Args...)`.
+		/// @param x Callable object to store.
+		template <typename Callback>
+			requires(!std::is_same_v<std::remove_cvref_t<Callback>, Delegate>)
+		// NOLINTNEXTLINE (google-explicit-constructor)
+		Delegate(Callback&& x)
+		{
+			using Stored = std::decay_t<Callback>;
+
+			if constexpr (StoredInline<Stored>)
+			{
+				::new (buffer()) Stored(std::forward<Callback>(x));
+
+				invoke_ = [](void* s, Args... args) -> R { return (*static_cast<Stored*>(s))(std::forward<Args>(args)...); };
+				manage_ = [](Op op, void* src, void* dst)
+				{
+					auto* self = static_cast<Stored*>(src);
+
+					if (op == Op::Move)
+					{
+						::new (dst) Stored(std::move(*self));
+					}
+
+					self->~Stored();
+				};
+			}
+			else
+			{
+				::new (buffer()) Stored*(new Stored(std::forward<Callback>(x)));
+
+				invoke_ = [](void* s, Args... args) -> R { return (**static_cast<Stored**>(s))(std::forward<Args>(args)...); };
+				manage_ = [](Op op, void* src, void* dst)
+				{
+					auto** self = static_cast<Stored**>(src);
+
+					if (op == Op::Move)
+					{
+						::new (dst) Stored*(*self);
+					}
+					else
+					{
+						delete *self;
+					}
+				};
+			}
+		}
+
+		/// @brief Destroy the stored callable, if any.
+		~Delegate()
+		{
+			if (manage_ != nullptr)
+			{
+				manage_(Op::Destroy, buffer(), nullptr);
+			}
+		}
+
+		Delegate(const Delegate&) = delete;
+		auto operator=(const Delegate&) -> Delegate& = delete;
+
+		/// @brief Move-construct, transferring the stored callable.
+		/// @param x Delegate to move from; left empty.
+		Delegate(Delegate&& x) noexcept : invoke_{x.invoke_}, manage_{x.manage_}
+		{
+			if (manage_ != nullptr)
+			{
+				manage_(Op::Move, x.buffer(), buffer());
+			}
+
+			x.invoke_ = nullptr;
+			x.manage_ = nullptr;
+		}
+
+		/// @brief Move-assign, transferring the stored callable.
+		/// @param x Delegate to move from; left empty.
+		auto operator=(Delegate&& x) noexcept -> Delegate&
+		{
+			if (this != &x)
+			{
+				if (manage_ != nullptr)
+				{
+					manage_(Op::Destroy, buffer(), nullptr);
+				}
+
+				invoke_ = x.invoke_;
+				manage_ = x.manage_;
+
+				if (manage_ != nullptr)
+				{
+					manage_(Op::Move, x.buffer(), buffer());
+				}
+
+				x.invoke_ = nullptr;
+				x.manage_ = nullptr;
+			}
+
+			return *this;
+		}
+
+		/// @brief Tells whether a callable is stored.
+		/// @return True if this delegate can be invoked.
+		[[nodiscard]] explicit operator bool() const noexcept
+		{
+			return invoke_ != nullptr;
+		}
+
+		/// @brief Invoke the stored callable.
+		///
+		/// The behavior is undefined if no callable is stored; callers are
+		/// expected to check `operator bool()` or guarantee non-emptiness (as
+		/// `Signal` does by construction).
+		///
+		/// @param args Arguments forwarded to the stored callable.
+		auto operator()(Args... args) const -> R
+		{
+			// NOLINTNEXTLINE (cppcoreguidelines-pro-type-const-cast)
+			return invoke_(const_cast<Delegate*>(this)->buffer(), std::forward<Args>(args)...);
+		}
+
+	private:
+		/// @brief Management operation selector for the type-erased manager.
+		enum class Op : std::uint8_t
+		{
+			Destroy,
+			Move
+		};
+
+		/// @brief Tells whether a callable type qualifies for inline storage.
+		template <typename T>
+		static constexpr bool StoredInline = sizeof(T) <= BufferSize && alignof(T) <= alignof(void*) && std::is_nothrow_move_constructible_v<T>;
+
+		[[nodiscard]] auto buffer() noexcept -> void*
+		{
+			return static_cast<void*>(buffer_.data());
+		}
+
+		using Invoke = R (*)(void*, Args...);
+		using Manage = void (*)(Op, void*, void*);
+
+		alignas(void*) std::array<std::byte, BufferSize> buffer_{};
+		Invoke invoke_{};
+		Manage manage_{};
+	};
+
 	/// @brief Primary template declaration for Signal.
 	///
 	/// This primary template is intentionally left undefined and is specialized
@@ -16,58 +207,64 @@ export namespace druid::core
 	template <typename T>
 	class Signal;
 
-	/// @brief Lightweight signal/callback wrapper for function-signature types.
+	/// @brief Multicast signal for function-signature types.
 	///
 	/// @tparam R Return type of the signal invocation.
 	/// @tparam Args Argument types accepted by the signal.
 	///
-	/// `Signal` provides a minimal observer-style mechanism where a single
-	/// callable can be connected and later invoked. It is intentionally simple:
-	/// - Only one callback is stored at a time.
+	/// `Signal` provides an observer-style mechanism where any number of
+	/// callables can be connected and later invoked:
+	/// - Connections are invoked in the order they were made.
 	/// - Invocation is safe if no callback is connected.
-	/// - Exceptions thrown by the callback are caught and suppressed.
+	/// - Exceptions thrown by a callback are caught and suppressed; remaining
+	///   callbacks for that emission are skipped.
 	///
-	/// This class serves as a thin wrapper around `std::function` while preserving
-	/// a function-signature–based interface.
-	///
-	/// @note
-	/// This wrapper exists primarily to ensure that RTTI / type information for
-	/// the function signature is emitted in translation units that include this
-	/// header. This helps avoid missing-symbol or RTTI-related issues on toolchains
-	/// with limited or incomplete C++20 module support.
+	/// Connected callables are stored contiguously as small-buffer-optimized
+	/// `Delegate` objects, so emission is a linear scan over inline storage
+	/// rather than a chain of `std::function` indirections.
 	template <typename R, typename... Args>
 	class Signal<R(Args...)>
 	{
 	public:
 		/// @brief Connect a callback to this signal.
 		///
-		/// Any previously connected callback is replaced. The provided callable
-		/// must be invocable with the signal's argument types.
+		/// The callback is appended to the connection list; previously connected
+		/// callbacks remain connected. The provided callable must be invocable
+		/// with the signal's argument types.
 		///
 		/// @tparam Callback Callable type compatible with `R(Args...)`.
 		/// @param callback Callable object to store and invoke.
 		template <typename Callback>
 		auto connect(Callback&& callback) -> void
 		{
-			signal_ = std::forward<Callback>(callback);
+			signals_.emplace_back(std::forward<Callback>(callback));
 		}
 
-		/// @brief Invoke the connected callback, if any.
+		/// @brief Invoke all connected callbacks in connection order.
 		///
 		/// If no callback is connected, this function is a no-op.
-		/// Any `std::exception` thrown by the callback is caught and ignored.
+		/// Any `std::exception` thrown by a callback is caught and ignored,
+		/// skipping the callbacks that had not yet run for this emission.
+		///
+		/// A callback may connect further callbacks to the signal it is
+		/// running on — they take effect on the next emission — and may
+		/// `clear()` it, which ends the emission after that callback.
 		///
-		/// @param args Arguments forwarded to the connected callback.
+		/// @param args Arguments passed to each connected callback.
 		auto operator()(Args... args) const noexcept -> void
 		{
-			if (!signal_)
-			{
-				return;
-			}
-
 			try
 			{
-				signal_(std::forward<Args>(args)...);
+				// Index against a snapshotted size as the upper bound: a
+				// callback connecting to this signal may reallocate the
+				// vector mid-emission. Re-check the live size too, since a
+				// callback may also clear() the signal it is running on.
+				const auto count = signals_.size();
+
+				for (std::size_t i = 0; i < count && i < signals_.size(); i++)
+				{
+					signals_[i](args...);
+				}
 			}
 			catch (const std::exception& e)
 			{
@@ -77,10 +274,28 @@ export namespace druid::core
 			}
 		}
 
+		/// @brief Get the number of connected callbacks.
+		/// @return Number of connections.
+		[[nodiscard]] auto size() const noexcept -> std::size_t
+		{
+			return signals_.size();
+		}
+
+		/// @brief Tells whether any callback is connected.
+		/// @return True if no callback is connected.
+		[[nodiscard]] auto empty() const noexcept -> bool
+		{
+			return signals_.empty();
+		}
+
+		/// @brief Disconnect all callbacks from this signal.
+		auto clear() noexcept -> void
+		{
+			signals_.clear();
+		}
+
 	private:
-		/// @brief Stored callback function.
-		///
-		/// An empty `std::function` indicates that no callback is connected.
-		std::function<R(Args...)> signal_{};
+		/// @brief Connected callbacks in connection order.
+		std::vector<Delegate<R(Args...)>> signals_{};
 	};
 }
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+import druid.core.Arena;
+import druid.core.Engine;
+import druid.core.Object;
+
+using druid::core::Arena;
+using druid::core::Engine;
+using druid::core::Object;
+
+TEST(Arena, create_aligned)
+{
+	Arena arena;
+	auto* a = arena.create<std::uint64_t>(1ULL);
+	auto* b = arena.create<std::uint64_t>(2ULL);
+
+	EXPECT_EQ(*a, 1ULL);
+	EXPECT_EQ(*b, 2ULL);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % alignof(std::uint64_t), 0U); // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+	EXPECT_EQ(arena.slab_count(), 1U);
+}
+
+TEST(Arena, grows_new_slabs)
+{
+	Arena arena{64U};
+	(void)arena.allocate(48U, 8U);
+	(void)arena.allocate(48U, 8U);
+	EXPECT_EQ(arena.slab_count(), 2U);
+}
+
+TEST(Arena, object_tree_allocates_from_arena)
+{
+	Engine engine;
+	Arena arena;
+
+	auto object = std::make_unique<Object>(engine);
+	object->set_arena(&arena);
+
+	auto& child = object->create_child("child");
+	EXPECT_EQ(child.get_arena(), &arena);
+
+	(void)child.create_child("grandchild");
+	EXPECT_GE(arena.slab_count(), 1U);
+	EXPECT_EQ(object->find_descendant("child/grandchild"), child.find_child("grandchild"));
+}
+
+TEST(Arena, destructors_run_on_removal)
+{
+	Engine engine;
+	Arena arena;
+
+	auto object = std::make_unique<Object>(engine);
+	object->set_arena(&arena);
+
+	auto destroyed = false;
+	auto& child = object->create_child("child");
+	child.on_destroyed([&destroyed] { destroyed = true; });
+
+	(void)child.remove();
+	EXPECT_TRUE(destroyed);
+}
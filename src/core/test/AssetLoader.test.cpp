@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+#include <thread>
+
+import druid.core.AssetLoader;
+import druid.core.Engine;
+
+using druid::core::AssetLoader;
+using druid::core::Engine;
+
+namespace
+{
+	constexpr std::string_view Contents{"asset loader test contents"};
+
+	auto write_temp_file() -> std::filesystem::path
+	{
+		const auto path = std::filesystem::temp_directory_path() / "druid-asset-test.bin";
+		std::ofstream ofs{path, std::ios::binary | std::ios::trunc};
+		ofs.write(Contents.data(), static_cast<std::streamsize>(Contents.size()));
+		return path;
+	}
+
+	auto wait_ready(const AssetLoader::Handle& x) -> void
+	{
+		while (!x.ready())
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds{1});
+		}
+	}
+}
+
+TEST(AssetLoader, request_and_poll)
+{
+	Engine engine;
+	auto& loader = engine.create_service<AssetLoader>();
+
+	const auto handle = loader.request(write_temp_file());
+	ASSERT_TRUE(handle.valid());
+
+	wait_ready(handle);
+	EXPECT_EQ(handle.data().size(), Contents.size());
+}
+
+TEST(AssetLoader, completion_callback_on_engine_thread)
+{
+	Engine engine;
+	auto& loader = engine.create_service<AssetLoader>();
+
+	auto completed = 0;
+	const auto handle = loader.request(write_temp_file(), [&completed](const AssetLoader::Handle& x) { completed += x.ready() ? 1 : 0; });
+
+	wait_ready(handle);
+
+	// Delivery happens in update(), not on the worker thread.
+	EXPECT_EQ(completed, 0);
+	loader.update(std::chrono::steady_clock::duration{});
+	EXPECT_EQ(completed, 1);
+}
+
+TEST(AssetLoader, missing_file_completes_empty)
+{
+	Engine engine;
+	auto& loader = engine.create_service<AssetLoader>();
+
+	const auto handle = loader.request("does-not-exist.bin");
+	wait_ready(handle);
+	EXPECT_TRUE(handle.data().empty());
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+import druid.core.DestructionQueue;
+import druid.core.Engine;
+import druid.core.Object;
+
+using druid::core::DestructionQueue;
+using druid::core::Engine;
+using druid::core::Object;
+using druid::core::ObjectPtr;
+
+TEST(DestructionQueue, defers_teardown_until_flush)
+{
+	Engine engine;
+	Object root{engine};
+	auto& child = root.create_child("doomed");
+
+	auto destroyed = false;
+	child.on_destroyed([&destroyed] { destroyed = true; });
+
+	DestructionQueue<ObjectPtr> queue;
+	queue.push(child.detach());
+
+	// Detached but queued: the subtree is still alive.
+	EXPECT_EQ(root.children().size(), 0);
+	EXPECT_FALSE(destroyed);
+	EXPECT_EQ(queue.size(), 1);
+
+	EXPECT_EQ(queue.flush(), 1);
+	EXPECT_TRUE(destroyed);
+	EXPECT_TRUE(queue.empty());
+}
+
+TEST(DestructionQueue, budget_flush_carries_remainder)
+{
+	Engine engine;
+	Object root{engine};
+	DestructionQueue<ObjectPtr> queue;
+
+	constexpr auto Count{16};
+
+	for (auto i = 0; i < Count; i++)
+	{
+		queue.push(root.create_child().detach());
+	}
+
+	// A zero budget still destroys exactly one entry per flush.
+	EXPECT_EQ(queue.flush(std::chrono::steady_clock::duration{}), 1);
+	EXPECT_EQ(queue.size(), Count - 1);
+
+	// A generous budget drains the rest.
+	EXPECT_EQ(queue.flush(std::chrono::seconds{1}), Count - 1);
+	EXPECT_TRUE(queue.empty());
+}
+
+TEST(DestructionQueue, ignores_null_pointers)
+{
+	Engine engine;
+	DestructionQueue<ObjectPtr> queue;
+	queue.push(nullptr);
+	EXPECT_TRUE(queue.empty());
+
+	Object detached{engine};
+	queue.push(detached.detach());
+	EXPECT_TRUE(queue.empty());
+}
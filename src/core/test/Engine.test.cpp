@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
 import druid.core.Engine;
 
 using druid::core::Engine;
@@ -16,3 +20,199 @@ TEST(Engine, set_interval_fixed)
 	engine.set_interval_fixed(std::numeric_limits<std::chrono::milliseconds>::max());
 	EXPECT_EQ(engine.get_interval_fixed(), std::numeric_limits<std::chrono::milliseconds>::max());
 }
+
+TEST(Engine, set_interval_frame)
+{
+	Engine engine;
+	EXPECT_EQ(engine.get_interval_frame(), std::chrono::steady_clock::duration{});
+
+	engine.set_interval_frame(std::chrono::milliseconds{16});
+	EXPECT_EQ(engine.get_interval_frame(), std::chrono::milliseconds{16});
+}
+
+TEST(Engine, deterministic_ticks)
+{
+	Engine engine;
+	engine.set_deterministic(true);
+	EXPECT_TRUE(engine.get_deterministic());
+
+	auto fixed = 0;
+	auto frames = 0;
+
+	engine.on_update_fixed(
+		[&fixed](auto x)
+		{
+			fixed++;
+			EXPECT_EQ(x, Engine::DefaultIntervalFixed);
+		});
+
+	engine.on_update(
+		[&engine, &frames](auto x)
+		{
+			EXPECT_EQ(x, Engine::DefaultIntervalFixed);
+			frames++;
+
+			if (frames == 100)
+			{
+				engine.quit();
+			}
+		});
+
+	EXPECT_EQ(engine.run(), EXIT_SUCCESS);
+
+	// One fixed step per frame, decoupled from the wall clock: a simulated
+	// second runs in however long the callbacks take.
+	EXPECT_EQ(fixed, 100);
+}
+
+TEST(Engine, overrun_telemetry)
+{
+	Engine engine;
+	engine.set_interval_fixed(std::chrono::milliseconds{1});
+
+	auto dropped = std::chrono::steady_clock::duration{};
+	engine.on_overrun([&dropped](auto x) { dropped += x; });
+
+	auto frames = 0;
+	engine.on_update(
+		[&engine, &frames](auto)
+		{
+			// Each frame runs far longer than the five fixed steps the limit
+			// allows to catch up, forcing the backlog to be dropped.
+			std::this_thread::sleep_for(std::chrono::milliseconds{10});
+			frames++;
+
+			if (frames == 3)
+			{
+				engine.quit();
+			}
+		});
+
+	EXPECT_EQ(engine.run(), EXIT_SUCCESS);
+
+	EXPECT_GT(engine.get_overruns(), 0U);
+	EXPECT_GT(engine.get_drift().count(), 0);
+	EXPECT_EQ(engine.get_drift(), dropped);
+}
+
+TEST(Engine, governor_adapts_interval_under_sustained_load)
+{
+	Engine engine;
+	engine.set_interval_fixed(std::chrono::milliseconds{1});
+	engine.set_interval_fixed_bounds(std::chrono::milliseconds{1}, std::chrono::milliseconds{8});
+
+	auto frames = 0;
+	engine.on_update(
+		[&engine, &frames](auto)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds{8});
+			frames++;
+
+			if (frames == 20)
+			{
+				engine.quit();
+			}
+		});
+
+	EXPECT_EQ(engine.run(), EXIT_SUCCESS);
+
+	// Sustained overruns must lengthen the interval, staying within bounds.
+	EXPECT_GT(engine.get_interval_fixed(), std::chrono::milliseconds{1});
+	EXPECT_LE(engine.get_interval_fixed(), std::chrono::milliseconds{8});
+}
+
+TEST(Engine, timers)
+{
+	Engine engine;
+	engine.set_deterministic(true);
+
+	auto once = 0;
+	auto repeating = 0;
+	auto cancelled = 0;
+
+	// Deterministic frames advance engine time by exactly one fixed interval
+	// (10 ms), making timer deadlines frame-exact.
+	engine.add_timer(std::chrono::milliseconds{25}, [&once, &engine] { once += engine.get_time() == std::chrono::milliseconds{30} ? 1 : 100; });
+	engine.add_timer_repeating(std::chrono::milliseconds{20}, [&repeating] { repeating++; });
+
+	const auto handle = engine.add_timer(std::chrono::milliseconds{50}, [&cancelled] { cancelled++; });
+	EXPECT_TRUE(engine.cancel_timer(handle));
+	EXPECT_FALSE(engine.cancel_timer(handle));
+
+	auto frames = 0;
+	engine.on_update(
+		[&engine, &frames](auto)
+		{
+			frames++;
+
+			if (frames == 10)
+			{
+				engine.quit();
+			}
+		});
+
+	EXPECT_EQ(engine.run(), EXIT_SUCCESS);
+
+	EXPECT_EQ(once, 1);
+	EXPECT_EQ(repeating, 5);
+	EXPECT_EQ(cancelled, 0);
+}
+
+TEST(Engine, repeating_timer_cancels_itself)
+{
+	Engine engine;
+	engine.set_deterministic(true);
+
+	auto fired = 0;
+	druid::core::TimerHandle handle{};
+	handle = engine.add_timer_repeating(std::chrono::milliseconds{10},
+										[&engine, &fired, &handle]
+										{
+											fired++;
+											engine.cancel_timer(handle);
+										});
+
+	auto frames = 0;
+	engine.on_update(
+		[&engine, &frames](auto)
+		{
+			frames++;
+
+			if (frames == 5)
+			{
+				engine.quit();
+			}
+		});
+
+	EXPECT_EQ(engine.run(), EXIT_SUCCESS);
+	EXPECT_EQ(fired, 1);
+}
+
+TEST(Engine, frame_pacing_and_alpha)
+{
+	Engine engine;
+	engine.set_interval_frame(std::chrono::milliseconds{5});
+
+	auto frames = 0;
+	engine.on_update(
+		[&engine, &frames](auto)
+		{
+			frames++;
+
+			if (frames == 5)
+			{
+				engine.quit();
+			}
+		});
+
+	const auto start = std::chrono::steady_clock::now();
+	EXPECT_EQ(engine.run(), EXIT_SUCCESS);
+	const auto elapsed = std::chrono::steady_clock::now() - start;
+
+	// Five paced frames cannot finish faster than four full intervals.
+	EXPECT_GE(elapsed, std::chrono::milliseconds{20});
+
+	// The interpolation factor is the unsimulated fraction of a fixed step.
+	EXPECT_GE(engine.get_alpha(), 0.0F);
+	EXPECT_LT(engine.get_alpha(), 1.0F);
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <vector>
+
 import druid.core.enummask;
 
 namespace
@@ -85,4 +87,101 @@ TEST(EnumMask, clear)
 	EXPECT_FALSE(test.test(TestEnum::One));
 	EXPECT_FALSE(test.test(TestEnum::Two));
 	EXPECT_FALSE(test.test(TestEnum::Three));
-}
\ No newline at end of file
+}
+TEST(EnumMask, bitwise_operators)
+{
+	const druid::core::EnumMask<TestEnum> one{TestEnum::One, TestEnum::Two};
+	const druid::core::EnumMask<TestEnum> two{TestEnum::Two, TestEnum::Three};
+
+	const auto united = one | two;
+	EXPECT_TRUE(united.test(TestEnum::One));
+	EXPECT_TRUE(united.test(TestEnum::Two));
+	EXPECT_TRUE(united.test(TestEnum::Three));
+
+	const auto intersected = one & two;
+	EXPECT_FALSE(intersected.test(TestEnum::One));
+	EXPECT_TRUE(intersected.test(TestEnum::Two));
+	EXPECT_FALSE(intersected.test(TestEnum::Three));
+
+	const auto toggled = one ^ two;
+	EXPECT_TRUE(toggled.test(TestEnum::One));
+	EXPECT_FALSE(toggled.test(TestEnum::Two));
+	EXPECT_TRUE(toggled.test(TestEnum::Three));
+
+	const auto complemented = ~one;
+	EXPECT_FALSE(complemented.test(TestEnum::One));
+	EXPECT_FALSE(complemented.test(TestEnum::Two));
+	EXPECT_TRUE(complemented.test(TestEnum::Three));
+}
+
+TEST(EnumMask, compound_assignment)
+{
+	druid::core::EnumMask<TestEnum> test{TestEnum::One};
+	test |= druid::core::EnumMask<TestEnum>{TestEnum::Two};
+	EXPECT_EQ(test, (druid::core::EnumMask<TestEnum>{TestEnum::One, TestEnum::Two}));
+
+	test &= druid::core::EnumMask<TestEnum>{TestEnum::Two, TestEnum::Three};
+	EXPECT_EQ(test, druid::core::EnumMask<TestEnum>{TestEnum::Two});
+
+	test ^= druid::core::EnumMask<TestEnum>{TestEnum::Two, TestEnum::Three};
+	EXPECT_EQ(test, druid::core::EnumMask<TestEnum>{TestEnum::Three});
+}
+
+TEST(EnumMask, any_all_none)
+{
+	const druid::core::EnumMask<TestEnum> test{TestEnum::One, TestEnum::Two};
+	const druid::core::EnumMask<TestEnum> overlap{TestEnum::Two, TestEnum::Three};
+	const druid::core::EnumMask<TestEnum> disjoint{TestEnum::Three};
+
+	EXPECT_TRUE(test.any(overlap));
+	EXPECT_FALSE(test.any(disjoint));
+
+	EXPECT_TRUE(test.all(druid::core::EnumMask<TestEnum>{TestEnum::One}));
+	EXPECT_FALSE(test.all(overlap));
+
+	EXPECT_TRUE(test.none(disjoint));
+	EXPECT_FALSE(test.none(overlap));
+}
+
+TEST(EnumMask, count_and_empty)
+{
+	druid::core::EnumMask<TestEnum> test{};
+	EXPECT_TRUE(test.empty());
+	EXPECT_EQ(test.count(), 0);
+
+	test.set(TestEnum::One);
+	test.set(TestEnum::Three);
+	EXPECT_FALSE(test.empty());
+	EXPECT_EQ(test.count(), 2);
+}
+
+TEST(EnumMask, iterates_set_bits)
+{
+	const druid::core::EnumMask<TestEnum> test{TestEnum::One, TestEnum::Three};
+
+	std::vector<TestEnum> visited;
+	for (auto flag : test)
+	{
+		visited.push_back(flag);
+	}
+
+	ASSERT_EQ(visited.size(), 2);
+	EXPECT_EQ(visited[0], TestEnum::One);
+	EXPECT_EQ(visited[1], TestEnum::Three);
+
+	const druid::core::EnumMask<TestEnum> empty{};
+	EXPECT_EQ(empty.begin(), empty.end());
+}
+
+TEST(EnumMask, constexpr_composition)
+{
+	constexpr druid::core::EnumMask<TestEnum> One{TestEnum::One};
+	constexpr druid::core::EnumMask<TestEnum> Two{TestEnum::Two};
+	constexpr auto Both = One | Two;
+
+	static_assert(Both.test(TestEnum::One));
+	static_assert(Both.test(TestEnum::Two));
+	static_assert(Both.count() == 2);
+	static_assert((Both & One) == One);
+	static_assert(*Both.begin() == TestEnum::One);
+}
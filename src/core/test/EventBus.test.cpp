@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+import druid.core.Engine;
+import druid.core.Event;
+import druid.core.EventBus;
+
+using druid::core::Engine;
+using druid::core::EventBus;
+using druid::core::EventKeyboard;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+namespace
+{
+	/// @brief Gameplay-defined event type; the bus needs no registration for it.
+	struct EventDamage
+	{
+		int amount{};
+	};
+}
+
+TEST(EventBus, delivers_same_type_events_as_runs)
+{
+	EventBus bus;
+
+	std::vector<std::string> order;
+	bus.subscribe<EventDamage>([&order](const EventDamage& x) { order.push_back("damage:" + std::to_string(x.amount)); });
+	bus.subscribe<EventKeyboard>([&order](const EventKeyboard&) { order.emplace_back("key"); });
+
+	// Interleaved publishes land in per-type queues.
+	bus.publish(EventDamage{.amount = 1});
+	bus.publish(EventKeyboard{.type = EventKeyboard::Type::KeyPressed, .key = EventKeyboard::Key::A});
+	bus.publish(EventDamage{.amount = 2});
+
+	EXPECT_EQ(bus.pending<EventDamage>(), 2);
+	EXPECT_TRUE(order.empty());
+
+	// Dispatch drains each channel whole, so same-type events form one run.
+	bus.dispatch();
+	ASSERT_EQ(order.size(), 3);
+	EXPECT_EQ(order[0], "damage:1");
+	EXPECT_EQ(order[1], "damage:2");
+	EXPECT_EQ(order[2], "key");
+	EXPECT_EQ(bus.pending<EventDamage>(), 0);
+}
+
+TEST(EventBus, fans_out_to_every_subscriber)
+{
+	EventBus bus;
+
+	auto first = 0;
+	auto second = 0;
+	bus.subscribe<EventDamage>([&first](const EventDamage& x) { first += x.amount; });
+	bus.subscribe<EventDamage>([&second](const EventDamage& x) { second += x.amount; });
+
+	bus.publish(EventDamage{.amount = 5});
+	bus.dispatch();
+
+	EXPECT_EQ(first, 5);
+	EXPECT_EQ(second, 5);
+}
+
+TEST(EventBus, publish_during_dispatch_delivers_in_same_dispatch)
+{
+	EventBus bus;
+
+	auto hits = 0;
+	bus.subscribe<EventDamage>(
+		[&bus, &hits](const EventDamage& x)
+		{
+			hits++;
+
+			if (x.amount > 1)
+			{
+				bus.publish(EventDamage{.amount = x.amount - 1});
+			}
+		});
+
+	bus.publish(EventDamage{.amount = 3});
+	bus.dispatch();
+
+	EXPECT_EQ(hits, 3);
+	EXPECT_EQ(bus.pending<EventDamage>(), 0);
+}
+
+TEST(Engine, typed_channels_dispatch_at_frame_start)
+{
+	Engine engine;
+	engine.set_deterministic(true);
+
+	auto damage = 0;
+	engine.subscribe<EventDamage>([&damage](const EventDamage& x) { damage += x.amount; });
+
+	auto keys = 0;
+	engine.subscribe<EventKeyboard>([&keys](const EventKeyboard&) { keys++; });
+
+	auto frames = 0;
+	engine.on_update(
+		[&](auto)
+		{
+			frames++;
+
+			if (frames == 1)
+			{
+				// Published mid-frame: delivered at the next frame's events point.
+				engine.publish(EventDamage{.amount = 7});
+				engine.publish(EventKeyboard{.type = EventKeyboard::Type::KeyPressed, .key = EventKeyboard::Key::A});
+				EXPECT_EQ(damage, 0);
+			}
+
+			if (frames == 2)
+			{
+				EXPECT_EQ(damage, 7);
+				EXPECT_EQ(keys, 1);
+			}
+
+			if (frames >= 2)
+			{
+				engine.quit();
+			}
+		});
+
+	EXPECT_EQ(engine.run(), EXIT_SUCCESS);
+	EXPECT_EQ(damage, 7);
+	EXPECT_EQ(keys, 1);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
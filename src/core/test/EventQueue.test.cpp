@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+import druid.core.Event;
+import druid.core.EventQueue;
+
+using druid::core::Event;
+using druid::core::EventKeyboard;
+using druid::core::EventQueue;
+
+TEST(EventQueue, post_and_drain)
+{
+	EventQueue queue;
+
+	EXPECT_TRUE(queue.try_post(EventKeyboard{.type = EventKeyboard::Type::KeyPressed, .key = EventKeyboard::Key::A}));
+	EXPECT_TRUE(queue.try_post(EventKeyboard{.type = EventKeyboard::Type::KeyReleased, .key = EventKeyboard::Key::A}));
+
+	std::vector<Event> events;
+	queue.drain(events);
+
+	ASSERT_EQ(events.size(), 2U);
+	EXPECT_EQ(std::get<EventKeyboard>(events[0]).type, EventKeyboard::Type::KeyPressed);
+	EXPECT_EQ(std::get<EventKeyboard>(events[1]).type, EventKeyboard::Type::KeyReleased);
+}
+
+TEST(EventQueue, full_queue_rejects)
+{
+	EventQueue queue{2};
+
+	EXPECT_TRUE(queue.try_post(EventKeyboard{}));
+	EXPECT_TRUE(queue.try_post(EventKeyboard{}));
+	EXPECT_FALSE(queue.try_post(EventKeyboard{}));
+}
+
+TEST(EventQueue, concurrent_producers)
+{
+	EventQueue queue{4096};
+
+	constexpr auto Producers = 4;
+	constexpr auto PerProducer = 256;
+
+	std::vector<std::thread> producers;
+
+	for (auto i = 0; i < Producers; i++)
+	{
+		producers.emplace_back(
+			[&queue]
+			{
+				for (auto j = 0; j < PerProducer; j++)
+				{
+					(void)queue.try_post(EventKeyboard{.type = EventKeyboard::Type::KeyPressed, .key = EventKeyboard::Key::A});
+				}
+			});
+	}
+
+	for (auto& producer : producers)
+	{
+		producer.join();
+	}
+
+	std::vector<Event> events;
+	queue.drain(events);
+	EXPECT_EQ(events.size(), static_cast<std::size_t>(Producers * PerProducer));
+}
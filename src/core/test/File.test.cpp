@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+
+import druid.core.File;
+
+using druid::core::FileMapping;
+using druid::core::FileStream;
+using druid::core::ReadFile;
+
+namespace
+{
+	constexpr std::string_view Contents{"druid file io test contents"};
+
+	auto write_temp_file() -> std::filesystem::path
+	{
+		const auto path = std::filesystem::temp_directory_path() / "druid-file-test.bin";
+		std::ofstream ofs{path, std::ios::binary | std::ios::trunc};
+		ofs.write(Contents.data(), static_cast<std::streamsize>(Contents.size()));
+		return path;
+	}
+}
+
+TEST(File, read_file)
+{
+	const auto path = write_temp_file();
+	const auto bytes = ReadFile(path);
+	EXPECT_EQ(bytes.size(), Contents.size());
+}
+
+TEST(File, mapping_views_whole_file)
+{
+	const auto path = write_temp_file();
+	const FileMapping mapping{path};
+
+	ASSERT_TRUE(mapping.valid());
+	ASSERT_EQ(mapping.size(), Contents.size());
+
+	const auto data = mapping.data();
+	EXPECT_EQ(static_cast<char>(data.front()), Contents.front());
+	EXPECT_EQ(static_cast<char>(data.back()), Contents.back());
+}
+
+TEST(File, mapping_missing_file)
+{
+	const FileMapping mapping{"does-not-exist.bin"};
+	EXPECT_FALSE(mapping.valid());
+	EXPECT_EQ(mapping.size(), 0U);
+}
+
+TEST(File, stream_reads_in_chunks)
+{
+	const auto path = write_temp_file();
+	FileStream stream{path};
+
+	ASSERT_TRUE(stream.valid());
+	EXPECT_EQ(stream.size(), Contents.size());
+
+	std::array<std::byte, 8> chunk{};
+	auto total = std::size_t{};
+
+	for (auto count = stream.read(chunk); count != 0; count = stream.read(chunk))
+	{
+		total += count;
+	}
+
+	EXPECT_EQ(total, Contents.size());
+	EXPECT_TRUE(stream.eof());
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+import druid.core.Engine;
+import druid.core.Event;
+import druid.core.Input;
+
+using druid::core::Engine;
+using druid::core::EventKeyboard;
+using druid::core::EventMouse;
+using druid::core::Input;
+
+TEST(Input, key_state_and_edges)
+{
+	Engine engine;
+	auto& input = engine.create_service<Input>();
+
+	EXPECT_FALSE(input.is_down(Input::Key::W));
+
+	engine.event(EventKeyboard{.type = EventKeyboard::Type::KeyPressed, .key = EventKeyboard::Key::W});
+	EXPECT_TRUE(input.is_down(Input::Key::W));
+	EXPECT_TRUE(input.is_pressed(Input::Key::W));
+	EXPECT_FALSE(input.is_released(Input::Key::W));
+
+	// Edge state retires at end of frame; held state persists.
+	input.update_end();
+	EXPECT_TRUE(input.is_down(Input::Key::W));
+	EXPECT_FALSE(input.is_pressed(Input::Key::W));
+
+	// Key repeat while held is not a new press.
+	engine.event(EventKeyboard{.type = EventKeyboard::Type::KeyPressed, .key = EventKeyboard::Key::W});
+	EXPECT_FALSE(input.is_pressed(Input::Key::W));
+
+	engine.event(EventKeyboard{.type = EventKeyboard::Type::KeyReleased, .key = EventKeyboard::Key::W});
+	EXPECT_FALSE(input.is_down(Input::Key::W));
+	EXPECT_TRUE(input.is_released(Input::Key::W));
+
+	input.update_end();
+	EXPECT_FALSE(input.is_released(Input::Key::W));
+}
+
+TEST(Input, button_state)
+{
+	Engine engine;
+	auto& input = engine.create_service<Input>();
+
+	engine.event(EventMouse{.type = EventMouse::Type::ButtonPressed, .button = EventMouse::Button::Left});
+	EXPECT_TRUE(input.is_down(Input::Button::Left));
+	EXPECT_TRUE(input.is_pressed(Input::Button::Left));
+	EXPECT_FALSE(input.is_down(Input::Button::Right));
+
+	engine.event(EventMouse{.type = EventMouse::Type::ButtonReleased, .button = EventMouse::Button::Left});
+	EXPECT_FALSE(input.is_down(Input::Button::Left));
+	EXPECT_TRUE(input.is_released(Input::Button::Left));
+}
+
+TEST(Input, mouse_position_and_delta)
+{
+	Engine engine;
+	auto& input = engine.create_service<Input>();
+
+	// The first report establishes the position without a delta spike.
+	engine.event(EventMouse{.type = EventMouse::Type::Moved, .x = 100.0F, .y = 50.0F});
+	EXPECT_EQ(input.mouse_x(), 100.0F);
+	EXPECT_EQ(input.mouse_y(), 50.0F);
+	EXPECT_EQ(input.mouse_delta_x(), 0.0F);
+	EXPECT_EQ(input.mouse_delta_y(), 0.0F);
+
+	engine.event(EventMouse{.type = EventMouse::Type::Moved, .x = 110.0F, .y = 45.0F});
+	engine.event(EventMouse{.type = EventMouse::Type::Moved, .x = 115.0F, .y = 40.0F});
+	EXPECT_EQ(input.mouse_x(), 115.0F);
+	EXPECT_EQ(input.mouse_y(), 40.0F);
+	EXPECT_EQ(input.mouse_delta_x(), 15.0F);
+	EXPECT_EQ(input.mouse_delta_y(), -10.0F);
+
+	input.update_end();
+	EXPECT_EQ(input.mouse_delta_x(), 0.0F);
+	EXPECT_EQ(input.mouse_x(), 115.0F);
+}
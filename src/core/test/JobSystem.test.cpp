@@ -0,0 +1,29 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+import druid.core.JobSystem;
+
+using druid::core::JobSystem;
+
+TEST(JobSystem, submit_and_wait)
+{
+	JobSystem jobs{2};
+	std::atomic<int> count{};
+
+	constexpr auto Count = 100;
+
+	for (auto i = 0; i < Count; i++)
+	{
+		jobs.submit([&count] { count.fetch_add(1); });
+	}
+
+	jobs.wait();
+	EXPECT_EQ(count.load(), Count);
+}
+
+TEST(JobSystem, thread_count)
+{
+	const JobSystem jobs{3};
+	EXPECT_EQ(jobs.thread_count(), 3U);
+}
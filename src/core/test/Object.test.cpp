@@ -68,4 +68,50 @@ TEST(Object, find_child)
 	child = object->find_child("three");
 	ASSERT_NE(child, nullptr);
 	EXPECT_EQ(child, &three);
-}
\ No newline at end of file
+
+	EXPECT_EQ(object->find_child("never-interned-name"), nullptr);
+}
+
+TEST(Object, find_descendant)
+{
+	Engine engine;
+	auto object = std::make_unique<Object>(engine);
+	auto& hud = object->create_child("hud");
+	auto& health = hud.create_child("health");
+	auto& label = health.create_child("label");
+
+	EXPECT_EQ(object->find_descendant("hud"), &hud);
+	EXPECT_EQ(object->find_descendant("hud/health"), &health);
+	EXPECT_EQ(object->find_descendant("hud/health/label"), &label);
+	EXPECT_EQ(object->find_descendant("hud/missing/label"), nullptr);
+}
+
+TEST(Object, rename_updates_lookup)
+{
+	Engine engine;
+	auto object = std::make_unique<Object>(engine);
+	auto& child = object->create_child("before");
+
+	child.set_name("after");
+	EXPECT_EQ(object->find_child("before"), nullptr);
+	EXPECT_EQ(object->find_child("after"), &child);
+}
+TEST(Object, detach_is_swap_and_pop)
+{
+	Engine engine;
+	auto root = std::make_unique<Object>(engine);
+	auto& first = root->create_child("first");
+	(void)first;
+	auto& second = root->create_child("second");
+	auto& third = root->create_child("third");
+
+	// The last sibling takes the detached slot; order is not preserved.
+	auto owned = second.detach();
+	ASSERT_NE(owned, nullptr);
+	ASSERT_EQ(root->children().size(), 2);
+	EXPECT_EQ(root->children()[0]->get_name(), "first");
+	EXPECT_EQ(root->children()[1]->get_name(), "third");
+	EXPECT_EQ(owned->parent(), nullptr);
+	EXPECT_EQ(root->find_child("second"), nullptr);
+	EXPECT_EQ(root->find_child("third"), &third);
+}
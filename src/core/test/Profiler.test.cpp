@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdlib>
+
+import druid.core.Engine;
+import druid.core.Profiler;
+
+using druid::core::Engine;
+using druid::core::Profiler;
+
+TEST(Profiler, record_and_snapshot)
+{
+	if constexpr (!Profiler::Enabled)
+	{
+		GTEST_SKIP() << "profiler instrumentation compiled out";
+	}
+
+	Profiler profiler;
+	const auto slot = profiler.slot("test");
+
+	profiler.record(slot, std::chrono::milliseconds{2});
+	profiler.record(slot, std::chrono::milliseconds{4});
+
+	// Accumulators only become visible after the frame snapshot.
+	EXPECT_EQ(profiler.samples()[slot].count, 0U);
+
+	profiler.begin_frame();
+
+	const auto& sample = profiler.samples()[slot];
+	EXPECT_EQ(sample.count, 2U);
+	EXPECT_EQ(sample.total, std::chrono::milliseconds{6});
+	EXPECT_EQ(sample.min, std::chrono::milliseconds{2});
+	EXPECT_EQ(sample.max, std::chrono::milliseconds{4});
+	EXPECT_FALSE(profiler.report().empty());
+}
+
+TEST(Profiler, slot_reuses_existing_name)
+{
+	Profiler profiler;
+	EXPECT_EQ(profiler.slot("one"), profiler.slot("one"));
+	EXPECT_NE(profiler.slot("one"), profiler.slot("two"));
+}
+
+TEST(Profiler, engine_instruments_frame)
+{
+	if constexpr (!Profiler::Enabled)
+	{
+		GTEST_SKIP() << "profiler instrumentation compiled out";
+	}
+
+	Engine engine;
+
+	auto frames = 0;
+	engine.on_update(
+		[&engine, &frames](auto)
+		{
+			frames++;
+
+			if (frames == 2)
+			{
+				engine.quit();
+			}
+		});
+
+	EXPECT_EQ(engine.run(), EXIT_SUCCESS);
+
+	// The snapshot describes the last completed frame: the update channel
+	// must have been timed exactly once.
+	auto found = false;
+
+	for (const auto& sample : engine.profiler().samples())
+	{
+		if (sample.name == "engine::update")
+		{
+			EXPECT_EQ(sample.count, 1U);
+			found = true;
+		}
+	}
+
+	EXPECT_TRUE(found);
+}
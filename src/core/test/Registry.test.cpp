@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+import druid.core.components;
+import druid.core.Registry;
+
+using druid::core::Position;
+using druid::core::Registry;
+using druid::core::Scale;
+
+TEST(Registry, create_and_valid)
+{
+	Registry registry;
+	const auto entity = registry.create();
+	EXPECT_TRUE(registry.valid(entity));
+}
+
+TEST(Registry, destroy_invalidates_handle)
+{
+	Registry registry;
+	const auto entity = registry.create();
+	registry.destroy(entity);
+	EXPECT_FALSE(registry.valid(entity));
+
+	// A recycled slot must not validate the stale handle.
+	const auto next = registry.create();
+	EXPECT_TRUE(registry.valid(next));
+	EXPECT_FALSE(registry.valid(entity));
+}
+
+TEST(Registry, emplace_and_get)
+{
+	Registry registry;
+	const auto entity = registry.create();
+
+	auto& pos = registry.emplace<Position>(entity, 1.0F, 2.0F);
+	EXPECT_EQ(pos.x, 1.0F);
+	EXPECT_EQ(pos.y, 2.0F);
+
+	auto* found = registry.get<Position>(entity);
+	ASSERT_NE(found, nullptr);
+	EXPECT_EQ(found->x, 1.0F);
+	EXPECT_EQ(found->y, 2.0F);
+
+	EXPECT_TRUE(registry.has<Position>(entity));
+	EXPECT_FALSE(registry.has<Scale>(entity));
+}
+
+TEST(Registry, remove_component)
+{
+	Registry registry;
+	const auto entity = registry.create();
+	(void)registry.emplace<Position>(entity, 1.0F, 2.0F);
+	(void)registry.emplace<Scale>(entity);
+
+	registry.remove<Scale>(entity);
+	EXPECT_FALSE(registry.has<Scale>(entity));
+
+	// The remaining component must survive the archetype move.
+	auto* pos = registry.get<Position>(entity);
+	ASSERT_NE(pos, nullptr);
+	EXPECT_EQ(pos->x, 1.0F);
+	EXPECT_EQ(pos->y, 2.0F);
+}
+
+TEST(Registry, view_iterates_matching_entities)
+{
+	Registry registry;
+
+	constexpr auto Count = 16;
+
+	for (auto i = 0; i < Count; i++)
+	{
+		const auto entity = registry.create();
+		(void)registry.emplace<Position>(entity, static_cast<float>(i), 0.0F);
+
+		// Only every other entity gets a Scale.
+		if (i % 2 == 0)
+		{
+			(void)registry.emplace<Scale>(entity, 2.0F, 2.0F);
+		}
+	}
+
+	auto matched = 0;
+
+	for (auto [pos, scale] : registry.view<Position, Scale>())
+	{
+		pos.y = pos.x * scale.x;
+		matched++;
+	}
+
+	EXPECT_EQ(matched, Count / 2);
+
+	auto total = 0;
+
+	for (auto [pos] : registry.view<Position>())
+	{
+		total++;
+	}
+
+	EXPECT_EQ(total, Count);
+}
@@ -9,4 +9,88 @@ TEST(Signal, connect)
 	Signal<void(int)> signal;
 
 	signal.connect([](int) {});
-}
\ No newline at end of file
+	EXPECT_EQ(signal.size(), 1U);
+}
+
+TEST(Signal, multicast_invocation_order)
+{
+	Signal<void(int)> signal;
+	std::vector<int> order;
+
+	signal.connect([&order](int x) { order.push_back(x + 1); });
+	signal.connect([&order](int x) { order.push_back(x + 2); });
+	signal.connect([&order](int x) { order.push_back(x + 3); });
+
+	signal(0);
+
+	ASSERT_EQ(order.size(), 3U);
+	EXPECT_EQ(order[0], 1);
+	EXPECT_EQ(order[1], 2);
+	EXPECT_EQ(order[2], 3);
+}
+
+TEST(Signal, clear)
+{
+	Signal<void()> signal;
+	auto count = 0;
+
+	signal.connect([&count] { count++; });
+	signal.connect([&count] { count++; });
+	EXPECT_EQ(signal.size(), 2U);
+
+	signal.clear();
+	EXPECT_TRUE(signal.empty());
+
+	signal();
+	EXPECT_EQ(count, 0);
+}
+
+TEST(Signal, connect_during_emission_defers_to_next)
+{
+	Signal<void()> signal;
+	auto first = 0;
+	auto second = 0;
+
+	// Connecting from inside a callback must not disturb the running
+	// emission; the new callback first fires on the next one.
+	signal.connect(
+		[&]
+		{
+			first++;
+
+			if (first == 1)
+			{
+				signal.connect([&second] { second++; });
+			}
+		});
+
+	signal();
+	EXPECT_EQ(first, 1);
+	EXPECT_EQ(second, 0);
+
+	signal();
+	EXPECT_EQ(first, 2);
+	EXPECT_EQ(second, 1);
+}
+
+TEST(Signal, clear_during_emission_stops_safely)
+{
+	Signal<void()> signal;
+	auto first = 0;
+	auto second = 0;
+
+	// Clearing from inside a callback ends the emission after it; the
+	// later connection must not be indexed out of bounds.
+	signal.connect(
+		[&]
+		{
+			first++;
+			signal.clear();
+		});
+	signal.connect([&second] { second++; });
+
+	signal();
+	EXPECT_EQ(first, 1);
+	EXPECT_EQ(second, 0);
+	EXPECT_TRUE(signal.empty());
+}
@@ -0,0 +1,210 @@
+module;
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+export module druid.graphics.CommandBuffer;
+
+import druid.graphics.Color;
+
+export namespace druid::graphics
+{
+	/// @struct DrawCommand
+	/// @brief One recorded draw call in a CommandBuffer.
+	///
+	/// Commands are trivially copyable so a frame's worth of draw calls lives
+	/// in one contiguous array. Text payloads are stored out-of-line in the
+	/// command buffer's string pool and referenced by offset/length.
+	struct DrawCommand
+	{
+		/// @enum Type
+		/// @brief Primitive kind recorded by the command.
+		enum class Type : std::uint8_t
+		{
+			/// @brief Filled axis-aligned rectangle.
+			Rectangle,
+			/// @brief Text string.
+			Text,
+			/// @brief Textured quad sampling a texture sub-rectangle.
+			Texture
+		};
+
+		/// @brief Primitive kind.
+		Type type{Type::Rectangle};
+		/// @brief X-coordinate of the primitive origin.
+		float x{};
+		/// @brief Y-coordinate of the primitive origin.
+		float y{};
+		/// @brief Width of the primitive (rectangles only).
+		float width{};
+		/// @brief Height of the primitive (rectangles only).
+		float height{};
+		/// @brief Primitive color (tint for textures).
+		Color color{};
+		/// @brief Font size (text only).
+		int font_size{};
+		/// @brief Texture handle (textures only).
+		std::uint32_t texture{};
+		/// @brief Sub-rectangle top-left X in texture pixels (textures only).
+		float source_x{};
+		/// @brief Sub-rectangle top-left Y in texture pixels (textures only).
+		float source_y{};
+		/// @brief Sub-rectangle width in texture pixels (textures only).
+		float source_width{};
+		/// @brief Sub-rectangle height in texture pixels (textures only).
+		float source_height{};
+		/// @brief Offset of the text payload in the string pool (text only).
+		std::uint32_t text_offset{};
+		/// @brief Length in bytes of the text payload (text only).
+		std::uint32_t text_length{};
+	};
+
+	/// @class CommandBuffer
+	/// @brief Contiguous recording of a frame's draw calls.
+	///
+	/// Instead of dispatching one virtual call per primitive, draw calls can be
+	/// recorded into a `CommandBuffer` and handed to the renderer in one
+	/// `Renderer::submit` call. Recording appends trivially-copyable
+	/// `DrawCommand` entries to a vector; `sort()` groups commands by primitive
+	/// kind and color so backends can submit long runs with minimal state
+	/// switching.
+	///
+	/// Text payloads are pooled in a single string, each stored with a trailing
+	/// null terminator so backends requiring C strings can consume the pooled
+	/// data without copying.
+	///
+	/// @note Sorting reorders draw calls; use it only for content where draw
+	///       order does not affect the result (e.g., non-overlapping UI runs).
+	class CommandBuffer
+	{
+	public:
+		/// @brief Record a filled rectangle.
+		///
+		/// @param x X-coordinate of the rectangle origin.
+		/// @param y Y-coordinate of the rectangle origin.
+		/// @param width Width of the rectangle.
+		/// @param height Height of the rectangle.
+		/// @param color Fill color of the rectangle.
+		auto record_rectangle(float x, float y, float width, float height, Color color) -> void
+		{
+			commands_.push_back({.type = DrawCommand::Type::Rectangle, .x = x, .y = y, .width = width, .height = height, .color = color});
+		}
+
+		/// @brief Record a text string.
+		///
+		/// The text is copied into the buffer's string pool.
+		///
+		/// @param x X-coordinate of the text origin.
+		/// @param y Y-coordinate of the text origin.
+		/// @param text UTF-8 text string to render.
+		/// @param font_size Font size in pixels (or backend-defined units).
+		/// @param color Text color.
+		auto record_text(float x, float y, std::string_view text, int font_size, Color color) -> void
+		{
+			const auto offset = static_cast<std::uint32_t>(text_.size());
+			text_.append(text);
+			text_.push_back('\0');
+
+			commands_.push_back({.type = DrawCommand::Type::Text,
+								 .x = x,
+								 .y = y,
+								 .color = color,
+								 .font_size = font_size,
+								 .text_offset = offset,
+								 .text_length = static_cast<std::uint32_t>(text.size())});
+		}
+
+		/// @brief Record a textured quad.
+		///
+		/// @param texture Texture handle; typically a shared atlas page.
+		/// @param source_x Sub-rectangle top-left X in texture pixels.
+		/// @param source_y Sub-rectangle top-left Y in texture pixels.
+		/// @param source_width Sub-rectangle width in texture pixels.
+		/// @param source_height Sub-rectangle height in texture pixels.
+		/// @param x X-coordinate of the quad origin.
+		/// @param y Y-coordinate of the quad origin.
+		/// @param width Width of the drawn quad.
+		/// @param height Height of the drawn quad.
+		/// @param tint Tint color multiplied with the texture.
+		auto record_texture(std::uint32_t texture, float source_x, float source_y, float source_width, float source_height, float x, float y, float width,
+							float height, Color tint) -> void
+		{
+			commands_.push_back({.type = DrawCommand::Type::Texture,
+								 .x = x,
+								 .y = y,
+								 .width = width,
+								 .height = height,
+								 .color = tint,
+								 .texture = texture,
+								 .source_x = source_x,
+								 .source_y = source_y,
+								 .source_width = source_width,
+								 .source_height = source_height});
+		}
+
+		/// @brief Sort recorded commands by primitive kind, texture, then color.
+		///
+		/// Sorting is stable, so commands sharing a key keep their recording
+		/// order. Grouped runs let backends avoid per-command state changes —
+		/// in particular, sprites sharing an atlas page form one texture run.
+		auto sort() -> void
+		{
+			std::ranges::stable_sort(commands_, {},
+									 [](const DrawCommand& x)
+									 {
+										 const auto color = (static_cast<std::uint32_t>(x.color.red()) << 24U) | (static_cast<std::uint32_t>(x.color.green()) << 16U) |
+															(static_cast<std::uint32_t>(x.color.blue()) << 8U) | static_cast<std::uint32_t>(x.color.alpha());
+										 return std::tuple{x.type, x.texture, color};
+									 });
+		}
+
+		/// @brief Discard all recorded commands and pooled text.
+		auto clear() noexcept -> void
+		{
+			commands_.clear();
+			text_.clear();
+		}
+
+		/// @brief Get the recorded commands.
+		/// @return Read-only span over the command array.
+		[[nodiscard]] auto commands() const noexcept -> std::span<const DrawCommand>
+		{
+			return commands_;
+		}
+
+		/// @brief Get a command's text payload from the string pool.
+		///
+		/// The returned view's data is null-terminated in the pool.
+		///
+		/// @param x Text command to resolve.
+		/// @return View of the command's text.
+		[[nodiscard]] auto text(const DrawCommand& x) const noexcept -> std::string_view
+		{
+			return {text_.data() + x.text_offset, x.text_length};
+		}
+
+		/// @brief Tells whether the buffer holds no commands.
+		/// @return True if empty.
+		[[nodiscard]] auto empty() const noexcept -> bool
+		{
+			return commands_.empty();
+		}
+
+		/// @brief Get the number of recorded commands.
+		/// @return Command count.
+		[[nodiscard]] auto size() const noexcept -> std::size_t
+		{
+			return commands_.size();
+		}
+
+	private:
+		std::vector<DrawCommand> commands_;
+		std::string text_;
+	};
+}
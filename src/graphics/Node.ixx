@@ -1,22 +1,145 @@
 module;
 
-#include <raylib.h>
 #include <algorithm>
+#include <cmath>
 #include <glm/glm.hpp>
-#include <glm/gtc/type_ptr.hpp>
+#include <cstddef>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 export module druid.graphics.Node;
 
+import druid.core.Arena;
 import druid.core.Signal;
 import druid.graphics.Renderer;
 
+using druid::core::Arena;
 using druid::core::Signal;
 
 export namespace druid::graphics
 {
+	/// @struct Affine2
+	/// @brief Compact 2D affine transform (2x3 matrix, column-major).
+	///
+	/// Stores exactly the six coefficients a strictly 2D translate/rotate/scale
+	/// transform needs — 24 bytes instead of a 64-byte `glm::mat4`. The layout
+	/// matches the upper-left 2x2 block plus translation column of the
+	/// equivalent mat4, so composition order is identical.
+	struct Affine2
+	{
+		/// @brief First column X component (cos * scale.x).
+		float a{1.0F};
+		/// @brief First column Y component (sin * scale.x).
+		float b{0.0F};
+		/// @brief Second column X component (-sin * scale.y).
+		float c{0.0F};
+		/// @brief Second column Y component (cos * scale.y).
+		float d{1.0F};
+		/// @brief Translation X component.
+		float tx{0.0F};
+		/// @brief Translation Y component.
+		float ty{0.0F};
+
+		/// @brief Compose two transforms (apply `x` first, then this).
+		///
+		/// Equivalent to the mat4 product `this * x`, restricted to 2D.
+		///
+		/// @param x Child/local transform to compose under this transform.
+		/// @return Combined transform.
+		[[nodiscard]] constexpr auto operator*(const Affine2& x) const noexcept -> Affine2
+		{
+			return {.a = a * x.a + c * x.b,
+					.b = b * x.a + d * x.b,
+					.c = a * x.c + c * x.d,
+					.d = b * x.c + d * x.d,
+					.tx = a * x.tx + c * x.ty + tx,
+					.ty = b * x.tx + d * x.ty + ty};
+		}
+
+		/// @brief Transform a point by this transform.
+		/// @param x Point to transform.
+		/// @return Transformed point.
+		[[nodiscard]] auto transform_point(const glm::vec2& x) const noexcept -> glm::vec2
+		{
+			return {a * x.x + c * x.y + tx, b * x.x + d * x.y + ty};
+		}
+
+		/// @brief Expand to a 4x4 matrix for backends that consume mat4.
+		///
+		/// The six coefficients land in the upper-left 2x2 block and the
+		/// translation column; the rest is identity.
+		///
+		/// @return Equivalent 4x4 transform matrix.
+		[[nodiscard]] auto to_mat4() const noexcept -> glm::mat4
+		{
+			auto matrix = glm::mat4{1.0F};
+			matrix[0][0] = a;
+			matrix[0][1] = b;
+			matrix[1][0] = c;
+			matrix[1][1] = d;
+			matrix[3][0] = tx;
+			matrix[3][1] = ty;
+			return matrix;
+		}
+	};
+
+	/// @struct Bounds
+	/// @brief Axis-aligned bounding box.
+	///
+	/// Default-constructed bounds are empty (`valid()` is false) and act as the
+	/// identity for `merge`, so aggregates can start from `Bounds{}` and fold
+	/// boxes in without special cases.
+	struct Bounds
+	{
+		/// @brief Minimum corner; above the maximum while empty.
+		glm::vec2 min{std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+		/// @brief Maximum corner; below the minimum while empty.
+		glm::vec2 max{std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+
+		/// @brief Tells whether the bounds enclose anything.
+		/// @return True once at least one point or box has been folded in.
+		[[nodiscard]] constexpr auto valid() const noexcept -> bool
+		{
+			return min.x <= max.x && min.y <= max.y;
+		}
+
+		/// @brief Grow the bounds to include a point.
+		/// @param x Point to include.
+		auto expand(const glm::vec2& x) noexcept -> void
+		{
+			min = glm::min(min, x);
+			max = glm::max(max, x);
+		}
+
+		/// @brief Grow the bounds to include another box.
+		/// @param x Bounds to include; empty bounds leave this box unchanged.
+		auto merge(const Bounds& x) noexcept -> void
+		{
+			min = glm::min(min, x.min);
+			max = glm::max(max, x.max);
+		}
+
+		/// @brief Tells whether two boxes overlap.
+		/// @param x Bounds to test against.
+		/// @return True when the boxes share any area (touching edges count).
+		[[nodiscard]] constexpr auto intersects(const Bounds& x) const noexcept -> bool
+		{
+			return min.x <= x.max.x && x.min.x <= max.x && min.y <= x.max.y && x.min.y <= max.y;
+		}
+
+		/// @brief Tells whether a point lies inside the box.
+		/// @param x Point to test.
+		/// @return True when the point is inside or on the edge.
+		[[nodiscard]] constexpr auto contains(const glm::vec2& x) const noexcept -> bool
+		{
+			return min.x <= x.x && x.x <= max.x && min.y <= x.y && x.y <= max.y;
+		}
+	};
+
 	class Node;
 
 	/// @concept NodeType
@@ -24,6 +147,22 @@ export namespace druid::graphics
 	template <typename T>
 	concept NodeType = std::is_base_of_v<Node, T>;
 
+	/// @struct NodeDeleter
+	/// @brief Deleter that knows whether a node lives in an arena.
+	///
+	/// Heap-allocated nodes are deleted normally; arena-allocated nodes only
+	/// have their destructor run — the storage is reclaimed wholesale when
+	/// the arena itself is destroyed.
+	struct NodeDeleter
+	{
+		Arena* arena{};
+
+		auto operator()(Node* x) const noexcept -> void;
+	};
+
+	/// @brief Owning pointer to a node, heap- or arena-backed.
+	using NodePtr = std::unique_ptr<Node, NodeDeleter>;
+
 	/// @class Node
 	/// @brief Scene-graph node with local transform and draw callback support.
 	///
@@ -64,7 +203,7 @@ export namespace druid::graphics
 
 		/// @brief Add a child node to this node.
 		/// @param child The child node to add (ownership transferred).
-		auto add_child(std::unique_ptr<Node> child) -> void
+		auto add_child(NodePtr child) -> void
 		{
 			if (child == nullptr)
 			{
@@ -72,13 +211,29 @@ export namespace druid::graphics
 			}
 
 			child->parent_node_ = this;
+
+			if (child->arena_ == nullptr)
+			{
+				child->arena_ = arena_;
+			}
+
 			child->dirty_global();
 			children_.emplace_back(std::move(child));
+			dirty_draw_cache();
+			dirty_bounds();
+			dirty_draw();
+		}
+
+		/// @brief Add a heap-allocated child node to this node.
+		/// @param child The child node to add (ownership transferred).
+		auto add_child(std::unique_ptr<Node> child) -> void
+		{
+			add_child(NodePtr{child.release(), NodeDeleter{}});
 		}
 
 		/// @brief Remove this node from its parent if it has one.
-		/// @return The owning unique_ptr of this node, or nullptr if no parent.
-		[[nodiscard]] auto remove() -> std::unique_ptr<Node>
+		/// @return The owning pointer of this node, or nullptr if no parent.
+		[[nodiscard]] auto remove() -> NodePtr
 		{
 			if (parent_node_ == nullptr)
 			{
@@ -96,7 +251,57 @@ export namespace druid::graphics
 			auto* parent = parent_node_;
 			parent_node_ = nullptr;
 			dirty_global();
+			// This node is a root now; its own flattened cache from any
+			// earlier stint as a drawn root is stale.
+			draw_cache_dirty_ = true;
 			parent->children_.erase(it);
+			parent->dirty_draw_cache();
+			parent->dirty_bounds();
+			parent->dirty_draw();
+			return node;
+		}
+
+		/// @brief Detach this node from its parent without preserving sibling order.
+		///
+		/// Swap-and-pop variant of `remove`: the last sibling takes this
+		/// node's slot, so no elements shift — bulk despawns detach in
+		/// constant time per node regardless of child count. Sibling order is
+		/// draw order for overlapping content; use `remove` when it matters.
+		/// Pair with a `DestructionQueue` to also defer the subtree's
+		/// teardown out of the frame.
+		///
+		/// @return The owning pointer of this node, or nullptr if no parent.
+		[[nodiscard]] auto detach() -> NodePtr
+		{
+			if (parent_node_ == nullptr)
+			{
+				return nullptr;
+			}
+
+			auto it = std::ranges::find_if(parent_node_->children_, [this](const auto& node) { return this == node.get(); });
+
+			if (it == std::end(parent_node_->children_))
+			{
+				return nullptr;
+			}
+
+			auto node = std::move(*it);
+			auto* parent = parent_node_;
+			parent_node_ = nullptr;
+			dirty_global();
+			// This node is a root now; its own flattened cache from any
+			// earlier stint as a drawn root is stale.
+			draw_cache_dirty_ = true;
+
+			if (std::next(it) != std::end(parent->children_))
+			{
+				*it = std::move(parent->children_.back());
+			}
+
+			parent->children_.pop_back();
+			parent->dirty_draw_cache();
+			parent->dirty_bounds();
+			parent->dirty_draw();
 			return node;
 		}
 
@@ -109,10 +314,29 @@ export namespace druid::graphics
 
 		/// @brief Get the list of children this node owns.
 		/// @return Read-only vector of child nodes.
-		[[nodiscard]] auto children() const noexcept -> const std::vector<std::unique_ptr<Node>>&
+		[[nodiscard]] auto children() const noexcept -> const std::vector<NodePtr>&
 		{
 			return children_;
 		}
+
+		/// @brief Back this tree's child allocations with an arena.
+		///
+		/// Children created through `create_node` after this call are
+		/// constructed in arena slabs and inherit the arena for their own
+		/// children. The arena must outlive the subtree.
+		///
+		/// @param x Arena to allocate children from, or nullptr to revert to the heap.
+		auto set_arena(Arena* x) noexcept -> void
+		{
+			arena_ = x;
+		}
+
+		/// @brief Get the arena backing this tree's child allocations.
+		/// @return The arena, or nullptr when children are heap-allocated.
+		[[nodiscard]] auto get_arena() const noexcept -> Arena*
+		{
+			return arena_;
+		}
 		/// @brief Set the local position of this node.
 		/// @param pos New local position.
 		auto set_position(const glm::vec2& pos) -> void
@@ -136,11 +360,8 @@ export namespace druid::graphics
 		/// @return Global/world position.
 		[[nodiscard]] auto get_position_global() const -> glm::vec2
 		{
-			// NOLINTNEXTLINE (cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
-			const auto pos = glm::vec3{transform_global()[3]};
-
-			// NOLINTNEXTLINE (cppcoreguidelines-pro-type-union-access,-warnings-as-errors)
-			return {pos.x, pos.y};
+			const auto& affine = affine_global();
+			return {affine.tx, affine.ty};
 		}
 
 		/// @brief Set the local scale of this node.
@@ -175,7 +396,8 @@ export namespace druid::graphics
 
 		/// @brief Create and attach a child node of type `T`.
 		///
-		/// The child is owned by this node via unique_ptr.
+		/// When this tree has an arena (see `set_arena`), the child is
+		/// constructed in arena storage; otherwise it is heap-allocated.
 		///
 		/// @tparam T Node type (must derive from Node).
 		/// @tparam Args Constructor argument types for T.
@@ -184,6 +406,13 @@ export namespace druid::graphics
 		template <NodeType T, typename... Args>
 		[[nodiscard]] auto create_node(Args&&... args) -> T&
 		{
+			if (arena_ != nullptr)
+			{
+				auto* ptr = arena_->create<T>(std::forward<Args>(args)...);
+				add_child(NodePtr{ptr, NodeDeleter{.arena = arena_}});
+				return *ptr;
+			}
+
 			auto child = std::make_unique<T>(std::forward<Args>(args)...);
 			auto* ptr = child.get();
 			add_child(std::move(child));
@@ -199,63 +428,299 @@ export namespace druid::graphics
 
 		/// @brief Get the local transform matrix.
 		///
-		/// The transform is derived from local position/scale/rotation.
+		/// Expanded on demand from the compact 2D affine — nodes store no
+		/// mat4; the 4x4 form exists only for backends that consume it.
 		///
 		/// @return Local transform matrix.
 		[[nodiscard]] auto transform() const -> glm::mat4
 		{
-			if (transform_dirty_)
+			return local_affine().to_mat4();
+		}
+
+		/// @brief Get the local transform as a compact 2D affine.
+		///
+		/// Composed directly from position/rotation/scale with one sin/cos
+		/// pair — no 4x4 matrix multiplies.
+		///
+		/// @return Local 2D affine transform.
+		[[nodiscard]] auto local_affine() const -> Affine2
+		{
+			const auto radians = glm::radians(rotation_);
+			const auto sin = std::sin(radians);
+			const auto cos = std::cos(radians);
+
+			return {.a = cos * scale_.x, .b = sin * scale_.x, .c = -sin * scale_.y, .d = cos * scale_.y, .tx = position_.x, .ty = position_.y};
+		}
+
+		/// @brief Get the global transform as a compact 2D affine.
+		///
+		/// Lazily recomputed through the parent chain when dirty; the batch
+		/// pass in `propagate_transforms` pre-cleans whole trees linearly so
+		/// per-node evaluation here is normally a cache hit.
+		///
+		/// @return Global/world 2D affine transform.
+		[[nodiscard]] auto affine_global() const -> const Affine2&
+		{
+			if (affine_global_dirty_)
 			{
-				const auto translation = glm::translate(glm::mat4(1.0F), glm::vec3(position_.x, position_.y, 0.0F));
-				const auto rotation = glm::rotate(glm::mat4(1.0F), glm::radians(rotation_), glm::vec3(0.0F, 0.0F, 1.0F));
-				const auto scaling = glm::scale(glm::mat4(1.0F), glm::vec3(scale_.x, scale_.y, 1.0F));
-				transform_ = translation * rotation * scaling;
-				transform_dirty_ = false;
+				if (parent_node_ != nullptr)
+				{
+					affine_global_ = parent_node_->affine_global() * local_affine();
+				}
+				else
+				{
+					affine_global_ = local_affine();
+				}
+
+				affine_global_dirty_ = false;
 			}
-			return transform_;
+
+			return affine_global_;
 		}
 
-		/// @brief Get the global transform matrix.
+		/// @brief Get this node's drawable bounds in local space.
 		///
-		/// The global transform composes this node's local transform with all
-		/// ancestor transforms up to the root.
+		/// The base node draws nothing of its own, so the default is empty
+		/// bounds: the node is never culled by itself and participates in
+		/// culling only through bounded descendants. Subclasses that draw
+		/// sized content (e.g., `NodeRectangle`) override this so the culling
+		/// pass can reject them; custom draw callbacks on a plain node should
+		/// live on a subclass with real bounds to be cullable.
 		///
-		/// @return Global/world transform matrix.
-		[[nodiscard]] auto transform_global() const -> glm::mat4
+		/// @return Local-space bounds; empty when the node has no intrinsic size.
+		[[nodiscard]] virtual auto local_bounds() const -> Bounds
 		{
-			if (transform_global_dirty_)
+			return {};
+		}
+
+		/// @brief Get this node's drawable bounds in world space.
+		///
+		/// Transforms the four corners of `local_bounds` by the global affine
+		/// and takes their axis-aligned box, so rotated content is bounded
+		/// conservatively.
+		///
+		/// @return World-space bounds; empty when `local_bounds` is empty.
+		[[nodiscard]] auto global_bounds() const -> Bounds
+		{
+			const auto local = local_bounds();
+
+			if (!local.valid())
 			{
-				if (parent_node_ != nullptr)
+				return local;
+			}
+
+			const auto& affine = affine_global();
+			Bounds bounds;
+			bounds.expand(affine.transform_point(local.min));
+			bounds.expand(affine.transform_point({local.max.x, local.min.y}));
+			bounds.expand(affine.transform_point(local.max));
+			bounds.expand(affine.transform_point({local.min.x, local.max.y}));
+			return bounds;
+		}
+
+		/// @brief Get the world-space bounds of this node and all descendants.
+		///
+		/// Cached per node and invalidated by transform or topology changes, so
+		/// a static subtree answers from its cache. This is the aggregate the
+		/// culling pass tests: one rejection here skips the whole subtree.
+		///
+		/// @return Merged world-space bounds of the subtree.
+		[[nodiscard]] auto subtree_bounds() const -> const Bounds&
+		{
+			if (subtree_bounds_dirty_)
+			{
+				subtree_bounds_ = global_bounds();
+
+				for (const auto& child : children_)
+				{
+					subtree_bounds_.merge(child->subtree_bounds());
+				}
+
+				subtree_bounds_dirty_ = false;
+			}
+
+			return subtree_bounds_;
+		}
+
+		/// @brief Update all dirty global transforms in one linear sweep.
+		///
+		/// Iterates the flattened traversal cache (parent-before-child order)
+		/// and recomputes each dirty node's global affine from its parent's
+		/// already-updated global affine. This replaces thousands of dependent
+		/// lazy evaluations with one pass over SoA-friendly 24-byte records.
+		/// Only meaningful on a root node; called automatically before a root
+		/// draw.
+		auto propagate_transforms() const -> void
+		{
+			if (draw_cache_dirty_)
+			{
+				draw_cache_.clear();
+				build_draw_cache(draw_cache_);
+				draw_cache_dirty_ = false;
+			}
+
+			for (const auto& entry : draw_cache_)
+			{
+				const auto* node = entry.node;
+
+				if (!node->affine_global_dirty_)
+				{
+					continue;
+				}
+
+				if (node->parent_node_ != nullptr)
 				{
-					transform_global_ = parent_node_->transform_global() * transform();
+					node->affine_global_ = node->parent_node_->affine_global_ * node->local_affine();
 				}
 				else
 				{
-					transform_global_ = transform();
+					node->affine_global_ = node->local_affine();
 				}
 
-				transform_global_dirty_ = false;
+				node->affine_global_dirty_ = false;
 			}
+		}
 
-			return transform_global_;
+		/// @brief Get the global transform matrix.
+		///
+		/// Expanded on demand from the cached global affine, which already
+		/// composes all ancestor transforms. No mat4 is stored per node.
+		///
+		/// @return Global/world transform matrix.
+		[[nodiscard]] auto transform_global() const -> glm::mat4
+		{
+			return affine_global().to_mat4();
 		}
 
 		/// @brief Draw this node using the provided renderer.
 		///
-		/// Applies the local transform, emits the on_draw signal, and recursively
-		/// draws all child nodes.
+		/// When called on a root node, drawing iterates a flattened traversal
+		/// cache: a contiguous array of node pointers in pre-order draw order,
+		/// rebuilt only when the tree topology changes. For a mostly static
+		/// tree this replaces the per-frame recursive walk with one linear
+		/// scan. Drawing a non-root subtree falls back to recursion.
 		///
 		/// @param x Renderer used for issuing draw calls.
 		auto draw(Renderer& x) const -> void
 		{
-			on_draw_(x);
+			if (parent_node_ != nullptr)
+			{
+				on_draw_(x);
 
-			for (const auto& child : children_)
+				for (const auto& child : children_)
+				{
+					child->draw(x);
+				}
+
+				return;
+			}
+
+			propagate_transforms();
+
+			for (const auto& entry : draw_cache_)
 			{
-				child->draw(x);
+				entry.node->on_draw_(x);
 			}
 		}
 
+		/// @brief Draw this node, culling subtrees outside a viewport.
+		///
+		/// Tests each subtree's cached world-space bounds against the viewport
+		/// and skips the whole subtree when they do not overlap — on the root
+		/// path by jumping over its span of the flattened cache, off-root by
+		/// pruning the recursion. Subtrees with no bounded content anywhere
+		/// are always drawn.
+		///
+		/// @param x Renderer used for issuing draw calls.
+		/// @param viewport World-space region to draw; content outside is skipped.
+		auto draw(Renderer& x, const Bounds& viewport) const -> void
+		{
+			if (parent_node_ != nullptr)
+			{
+				const auto& bounds = subtree_bounds();
+
+				if (bounds.valid() && !bounds.intersects(viewport))
+				{
+					return;
+				}
+
+				on_draw_(x);
+
+				for (const auto& child : children_)
+				{
+					child->draw(x, viewport);
+				}
+
+				return;
+			}
+
+			propagate_transforms();
+
+			for (std::size_t i = 0; i < draw_cache_.size();)
+			{
+				const auto& entry = draw_cache_[i];
+				const auto& bounds = entry.node->subtree_bounds();
+
+				if (bounds.valid() && !bounds.intersects(viewport))
+				{
+					i += entry.subtree_size;
+					continue;
+				}
+
+				entry.node->on_draw_(x);
+				i++;
+			}
+		}
+
+		/// @brief Find the topmost node whose drawable bounds contain a point.
+		///
+		/// Descends the tree through the cached subtree bounds — the same
+		/// aggregates the culling pass uses — rejecting whole subtrees whose
+		/// box misses the point, so a hit test touches O(log n) nodes instead
+		/// of walking the tree. The hierarchy is kept current by the existing
+		/// dirty-flag machinery; no separate index needs rebuilding. Children
+		/// are visited in reverse draw order, so of several overlapping hits
+		/// the one drawn last wins.
+		///
+		/// @param x World-space point to test (e.g., `EventMouse` coordinates).
+		/// @return Topmost node under the point, or nullptr when nothing is hit.
+		[[nodiscard]] auto pick(const glm::vec2& x) const -> const Node*
+		{
+			const auto& bounds = subtree_bounds();
+
+			if (bounds.valid() && !bounds.contains(x))
+			{
+				return nullptr;
+			}
+
+			for (auto it = children_.rbegin(); it != children_.rend(); ++it)
+			{
+				if (const auto* hit = (*it)->pick(x))
+				{
+					return hit;
+				}
+			}
+
+			const auto self = global_bounds();
+
+			if (self.valid() && self.contains(x))
+			{
+				return this;
+			}
+
+			return nullptr;
+		}
+
+		/// @brief Find the topmost node whose drawable bounds contain a point.
+		///
+		/// @param x World-space point to test.
+		/// @return Topmost node under the point, or nullptr when nothing is hit.
+		[[nodiscard]] auto pick(const glm::vec2& x) -> Node*
+		{
+			// NOLINTNEXTLINE (cppcoreguidelines-pro-type-const-cast)
+			return const_cast<Node*>(std::as_const(*this).pick(x));
+		}
+
 		/// @brief Subscribe to this node's draw callback.
 		///
 		/// The callback is invoked when `draw(Renderer&)` is executed for this node.
@@ -268,16 +733,66 @@ export namespace druid::graphics
 			on_draw_.connect(std::forward<Callback>(x));
 		}
 
+		/// @brief Tells whether this tree changed since damage was last cleared.
+		///
+		/// Meaningful on a root node: any transform, topology, or visual
+		/// change (size, color, text) anywhere in the tree marks the root
+		/// damaged. Backends use this to skip re-rendering identical frames.
+		///
+		/// @return True if the tree has unconsumed changes.
+		[[nodiscard]] auto damaged() const noexcept -> bool
+		{
+			return damage_;
+		}
+
+		/// @brief Clear the damage flag after the tree has been redrawn.
+		auto clear_damage() const noexcept -> void
+		{
+			damage_ = false;
+		}
+
+	protected:
+		/// @brief Mark this node's tree as visually changed.
+		///
+		/// Walks to the root and raises its damage flag. Subclasses call this
+		/// from setters that change appearance without touching the transform
+		/// (e.g. color or text changes).
+		auto dirty_draw() noexcept -> void
+		{
+			auto* root = this;
+
+			while (root->parent_node_ != nullptr)
+			{
+				root = root->parent_node_;
+			}
+
+			root->damage_ = true;
+		}
+
+		/// @brief Invalidate the cached subtree bounds of this node and its ancestors.
+		///
+		/// Called when this node's drawable extent changes (e.g., a rectangle
+		/// is resized): every aggregate up to the root includes this node's
+		/// bounds, so all must recompute.
+		auto dirty_bounds() noexcept -> void
+		{
+			for (auto* node = this; node != nullptr; node = node->parent_node_)
+			{
+				node->subtree_bounds_dirty_ = true;
+			}
+		}
+
 	private:
-		/// @brief Mark local transform dirty and propagate global dirty to children.
+		/// @brief Mark transforms dirty and propagate global dirty to children.
 		///
 		/// Called when local properties (position, scale, rotation) change.
-		/// This invalidates both the local transform and the global transform,
-		/// and propagates the global invalidation to all children.
+		/// The local affine is composed on the fly, so only the cached global
+		/// transform needs invalidating, propagated to all children.
 		auto dirty() -> void
 		{
-			transform_dirty_ = true;
 			dirty_global();
+			dirty_bounds();
+			dirty_draw();
 		}
 
 		/// @brief Mark only global transform dirty and propagate to children.
@@ -287,22 +802,82 @@ export namespace druid::graphics
 		/// transform, so changes must propagate down the hierarchy.
 		auto dirty_global() -> void
 		{
-			transform_global_dirty_ = true;
+			affine_global_dirty_ = true;
+			subtree_bounds_dirty_ = true;
 			for (auto& child : children_)
 			{
 				child->dirty_global();
 			}
 		}
 
-		std::vector<std::unique_ptr<Node>> children_;
+		/// @brief Invalidate the root's flattened traversal cache.
+		///
+		/// Called when the tree topology changes (`add_child`/`remove`). The
+		/// flag lives on the root node, which owns the cache for its tree.
+		auto dirty_draw_cache() -> void
+		{
+			auto* root = this;
+
+			while (root->parent_node_ != nullptr)
+			{
+				root = root->parent_node_;
+			}
+
+			root->draw_cache_dirty_ = true;
+		}
+
+		/// @brief One flattened traversal entry: a node and its subtree span.
+		///
+		/// `subtree_size` counts the node plus all descendants, so culling can
+		/// skip a rejected subtree by advancing that many entries.
+		struct CacheEntry
+		{
+			const Node* node{};
+			std::size_t subtree_size{};
+		};
+
+		/// @brief Append this node and its subtree to the cache in draw order.
+		/// @return Number of entries appended (this node plus descendants).
+		auto build_draw_cache(std::vector<CacheEntry>& x) const -> std::size_t
+		{
+			const auto index = x.size();
+			x.push_back({.node = this});
+
+			auto count = std::size_t{1};
+
+			for (const auto& child : children_)
+			{
+				count += child->build_draw_cache(x);
+			}
+
+			x[index].subtree_size = count;
+			return count;
+		}
+
+		std::vector<NodePtr> children_;
 		Node* parent_node_{nullptr};
+		Arena* arena_{};
+		mutable std::vector<CacheEntry> draw_cache_;
+		mutable bool draw_cache_dirty_{true};
+		mutable Bounds subtree_bounds_{};
+		mutable bool subtree_bounds_dirty_{true};
+		mutable bool damage_{true};
 		Signal<void(Renderer&)> on_draw_;
-		mutable glm::mat4 transform_{glm::mat4(1.0F)};
-		mutable glm::mat4 transform_global_{glm::mat4(1.0F)};
-		mutable bool transform_dirty_{true};
-		mutable bool transform_global_dirty_{true};
+		mutable Affine2 affine_global_{};
+		mutable bool affine_global_dirty_{true};
 		glm::vec2 position_{DefaultPosition};
 		glm::vec2 scale_{DefaultScale};
 		float rotation_{DefaultRotation};
 	};
+
+	inline auto NodeDeleter::operator()(Node* x) const noexcept -> void
+	{
+		if (arena != nullptr)
+		{
+			x->~Node();
+			return;
+		}
+
+		delete x; // NOLINT (cppcoreguidelines-owning-memory)
+	}
 }
@@ -54,6 +54,8 @@ export namespace druid::graphics
 		auto set_size(glm::vec2 x) -> void
 		{
 			size_ = x;
+			dirty_bounds();
+			dirty_draw();
 		}
 
 		/// @brief Get the rectangle size.
@@ -68,6 +70,7 @@ export namespace druid::graphics
 		auto set_color(const Color& color) -> void
 		{
 			color_ = color;
+			dirty_draw();
 		}
 
 		/// @brief Get the rectangle fill color.
@@ -96,6 +99,17 @@ export namespace druid::graphics
 			return size_ * Half;
 		}
 
+		/// @brief Get the rectangle's bounds in local space.
+		///
+		/// Spans `top_left` to `bottom_right`, letting the culling pass in
+		/// `Node::draw` skip rectangles outside the viewport.
+		///
+		/// @return Local-space bounds of the rectangle.
+		[[nodiscard]] auto local_bounds() const -> Bounds override
+		{
+			return {.min = top_left(), .max = bottom_right()};
+		}
+
 	private:
 		static constexpr auto Half{0.5F};
 		glm::vec2 size_{};
@@ -0,0 +1,181 @@
+module;
+
+#include <functional>
+#include <glm/glm.hpp>
+
+export module druid.graphics.NodeSprite;
+
+import druid.graphics.Color;
+import druid.graphics.Node;
+import druid.graphics.Renderer;
+
+export namespace druid::graphics
+{
+	/// @class NodeSprite
+	/// @brief Scene-graph node that renders a textured quad from an atlas.
+	///
+	/// `NodeSprite` draws a sub-rectangle of a texture — typically one frame
+	/// of a shared sprite atlas — as a quad centered about the node's local
+	/// origin. Because many sprites reference the same atlas page, the command
+	/// buffer sort groups them into long same-texture runs the backend can
+	/// submit without state changes.
+	///
+	/// The node's transform (position, scale, rotation) is inherited from
+	/// `Node` and applied before rendering.
+	class NodeSprite : public Node
+	{
+	public:
+		/// @brief Construct a sprite node.
+		///
+		/// Registers an internal draw callback that renders the current atlas
+		/// sub-rectangle with the current size and tint.
+		NodeSprite()
+		{
+			on_draw(
+				[this](auto& renderer)
+				{
+					if (texture_ == InvalidTexture)
+					{
+						return;
+					}
+
+					const auto pos = get_position_global();
+					const auto tl = top_left();
+					const auto size = draw_size();
+					renderer.draw_texture(texture_, source_position_, source_size_, tl.x + pos.x, tl.y + pos.y, size.x, size.y, color_);
+				});
+		}
+
+		/// @brief Virtual destructor.
+		~NodeSprite() override = default;
+
+		NodeSprite(const NodeSprite&) = delete;
+		NodeSprite(NodeSprite&&) noexcept = delete;
+		auto operator=(const NodeSprite&) -> NodeSprite& = delete;
+		auto operator=(NodeSprite&&) noexcept -> NodeSprite& = delete;
+
+		/// @brief Set the texture to sample.
+		///
+		/// The texture is shared, not owned: many sprites typically reference
+		/// the same atlas page, and the caller controls its lifetime.
+		///
+		/// @param x Texture handle from `Renderer::load_texture`.
+		auto set_texture(TextureHandle x) -> void
+		{
+			texture_ = x;
+			dirty_draw();
+		}
+
+		/// @brief Get the texture being sampled.
+		/// @return Texture handle; `InvalidTexture` when unset.
+		[[nodiscard]] auto get_texture() const -> TextureHandle
+		{
+			return texture_;
+		}
+
+		/// @brief Set the atlas sub-rectangle to sample.
+		///
+		/// @param position Top-left of the sub-rectangle in texture pixels.
+		/// @param size Size of the sub-rectangle in texture pixels.
+		auto set_source(glm::vec2 position, glm::vec2 size) -> void
+		{
+			source_position_ = position;
+			source_size_ = size;
+			dirty_bounds();
+			dirty_draw();
+		}
+
+		/// @brief Get the top-left of the atlas sub-rectangle in texture pixels.
+		/// @return Sub-rectangle position.
+		[[nodiscard]] auto get_source_position() const -> glm::vec2
+		{
+			return source_position_;
+		}
+
+		/// @brief Get the size of the atlas sub-rectangle in texture pixels.
+		/// @return Sub-rectangle size.
+		[[nodiscard]] auto get_source_size() const -> glm::vec2
+		{
+			return source_size_;
+		}
+
+		/// @brief Set the drawn quad size, overriding the source size.
+		///
+		/// When left at zero (the default) the sprite draws at the source
+		/// sub-rectangle's native pixel size.
+		///
+		/// @param x Size of the drawn quad (width, height).
+		auto set_size(glm::vec2 x) -> void
+		{
+			size_ = x;
+			dirty_bounds();
+			dirty_draw();
+		}
+
+		/// @brief Get the drawn quad size override.
+		/// @return Quad size; zero when drawing at native source size.
+		[[nodiscard]] auto get_size() const -> glm::vec2
+		{
+			return size_;
+		}
+
+		/// @brief Set the tint color multiplied with the texture.
+		/// @param color Tint color; white leaves the texture unchanged.
+		auto set_color(const Color& color) -> void
+		{
+			color_ = color;
+			dirty_draw();
+		}
+
+		/// @brief Get the tint color.
+		/// @return Tint color.
+		[[nodiscard]] auto get_color() const -> Color
+		{
+			return color_;
+		}
+
+		/// @brief Get the top-left corner of the drawn quad in local space.
+		///
+		/// The quad is centered about the node's local origin, mirroring
+		/// `NodeRectangle`.
+		///
+		/// @return Local-space coordinates of the top-left corner.
+		[[nodiscard]] auto top_left() const -> glm::vec2
+		{
+			return -draw_size() * Half;
+		}
+
+		/// @brief Get the bottom-right corner of the drawn quad in local space.
+		/// @return Local-space coordinates of the bottom-right corner.
+		[[nodiscard]] auto bottom_right() const -> glm::vec2
+		{
+			return draw_size() * Half;
+		}
+
+		/// @brief Get the sprite's bounds in local space.
+		///
+		/// Spans `top_left` to `bottom_right`, letting the culling pass in
+		/// `Node::draw` skip sprites outside the viewport.
+		///
+		/// @return Local-space bounds of the sprite.
+		[[nodiscard]] auto local_bounds() const -> Bounds override
+		{
+			return {.min = top_left(), .max = bottom_right()};
+		}
+
+	private:
+		static constexpr auto Half{0.5F};
+
+		/// @brief Effective quad size: the override, or the source size.
+		[[nodiscard]] auto draw_size() const -> glm::vec2
+		{
+			return size_ == glm::vec2{} ? source_size_ : size_;
+		}
+
+		TextureHandle texture_{InvalidTexture};
+		glm::vec2 source_position_{};
+		glm::vec2 source_size_{};
+		glm::vec2 size_{};
+		Color color_{Color::White};
+	};
+}
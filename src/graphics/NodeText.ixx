@@ -53,6 +53,7 @@ export namespace druid::graphics
 		auto set_text(std::string_view x) -> void
 		{
 			text_ = x;
+			dirty_draw();
 		}
 
 		/// @brief Get the current text string.
@@ -67,6 +68,7 @@ export namespace druid::graphics
 		auto set_font_size(int x) -> void
 		{
 			font_size_ = x;
+			dirty_draw();
 		}
 
 		/// @brief Get the current font size.
@@ -81,6 +83,7 @@ export namespace druid::graphics
 		auto set_color(const Color& color) -> void
 		{
 			color_ = color;
+			dirty_draw();
 		}
 
 		/// @brief Get the current text color.
@@ -0,0 +1,137 @@
+module;
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+export module druid.graphics.RenderThread;
+
+import druid.graphics.Color;
+import druid.graphics.CommandBuffer;
+import druid.graphics.Renderer;
+
+export namespace druid::graphics
+{
+	/// @class RenderThread
+	/// @brief Dedicated submission thread with double-buffered command queues.
+	///
+	/// The simulation thread records draw commands into one buffer while this
+	/// thread sorts and submits the previous frame's buffer to the backend.
+	/// `present` swaps the two at the frame boundary — blocking only if the
+	/// render thread is still busy with the prior frame — so a backend that
+	/// waits on vsync in `Renderer::end` does that wait here, overlapped with
+	/// the next simulation step instead of stalling it.
+	///
+	/// The backend's rendering context must be usable from this thread for
+	/// its whole lifetime (true for the headless renderer; raylib binds its
+	/// GL context to the thread that created the window, so the stock raylib
+	/// backend must keep single-threaded submission).
+	class RenderThread
+	{
+	public:
+		/// @brief Start the render thread against a backend.
+		/// @param x Renderer to submit to; must outlive this object.
+		explicit RenderThread(Renderer& x) : renderer_{&x}, thread_{[this] { worker(); }}
+		{
+		}
+
+		/// @brief Finish any in-flight frame and join the thread.
+		~RenderThread()
+		{
+			{
+				const std::scoped_lock lock{mutex_};
+				stop_ = true;
+			}
+
+			available_.notify_all();
+			thread_.join();
+		}
+
+		RenderThread(const RenderThread&) = delete;
+		RenderThread(RenderThread&&) noexcept = delete;
+		auto operator=(const RenderThread&) -> RenderThread& = delete;
+		auto operator=(RenderThread&&) noexcept -> RenderThread& = delete;
+
+		/// @brief Get the buffer the simulation thread records this frame into.
+		/// @return Recording command buffer; owned by the caller until `present`.
+		[[nodiscard]] auto record() noexcept -> CommandBuffer&
+		{
+			return back_;
+		}
+
+		/// @brief Hand the recorded frame to the render thread.
+		///
+		/// Blocks until the previous frame has been submitted (one frame of
+		/// pipelining), swaps the buffers, and wakes the render thread. The
+		/// recording buffer comes back cleared, ready for the next frame.
+		///
+		/// @param clear Background clear color for the frame.
+		auto present(Color clear) -> void
+		{
+			{
+				std::unique_lock lock{mutex_};
+				idle_.wait(lock, [this] { return !frame_ready_; });
+
+				std::swap(front_, back_);
+				clear_ = clear;
+				frame_ready_ = true;
+			}
+
+			available_.notify_one();
+			back_.clear();
+		}
+
+		/// @brief Block until the render thread has no frame in flight.
+		auto wait_idle() -> void
+		{
+			std::unique_lock lock{mutex_};
+			idle_.wait(lock, [this] { return !frame_ready_; });
+		}
+
+	private:
+		/// @brief Render-thread loop: sort and submit each presented frame.
+		///
+		/// The front buffer is touched without the lock held while
+		/// `frame_ready_` is set — the simulation side cannot swap again until
+		/// it is cleared.
+		auto worker() -> void
+		{
+			for (;;)
+			{
+				{
+					std::unique_lock lock{mutex_};
+					available_.wait(lock, [this] { return stop_ || frame_ready_; });
+
+					if (stop_)
+					{
+						return;
+					}
+				}
+
+				front_.sort();
+				renderer_->begin(clear_);
+				renderer_->submit(front_);
+				renderer_->end();
+
+				{
+					const std::scoped_lock lock{mutex_};
+					frame_ready_ = false;
+				}
+
+				idle_.notify_all();
+			}
+		}
+
+		Renderer* renderer_;
+		CommandBuffer front_;
+		CommandBuffer back_;
+		Color clear_{Color::Black};
+		std::mutex mutex_;
+		std::condition_variable available_;
+		std::condition_variable idle_;
+		bool frame_ready_{false};
+		bool stop_{false};
+		std::thread thread_;
+	};
+}
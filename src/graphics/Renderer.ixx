@@ -1,13 +1,24 @@
 module;
 
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <filesystem>
 #include <string>
+#include <string_view>
 
 export module druid.graphics.Renderer;
 
 import druid.graphics.Color;
+import druid.graphics.CommandBuffer;
 
 export namespace druid::graphics
 {
+	/// @brief Opaque handle to a backend texture (e.g., a sprite atlas page).
+	using TextureHandle = std::uint32_t;
+
+	/// @brief Handle value representing no texture.
+	constexpr auto InvalidTexture{TextureHandle{0}};
+
 	/// @class Renderer
 	/// @brief Abstract interface for issuing graphics draw commands.
 	///
@@ -20,9 +31,23 @@ export namespace druid::graphics
 	/// 1. `begin()` — prepare the frame and clear the background
 	/// 2. Draw calls (`draw_rectangle`, `draw_text`, …)
 	/// 3. `end()` — finalize and present the frame
+	///
+	/// Draw calls can operate in two modes:
+	/// - Immediate: each call is forwarded straight to the backend.
+	/// - Recorded: with a `CommandBuffer` attached via `set_command_buffer`,
+	///   calls append trivially-copyable commands to the buffer instead, and
+	///   the whole buffer is handed to the backend in one `submit` call.
+	///   Scene-graph draw callbacks are unaffected by the mode; the immediate
+	///   API acts as a thin recorder on top of the buffer.
 	class Renderer
 	{
 	public:
+		/// @brief Approximate width of a glyph relative to the font size.
+		///
+		/// Used by the default `measure_text` when a backend provides no real
+		/// font metrics.
+		static constexpr auto DefaultGlyphAspect{0.6F};
+
 		/// @brief Default constructor.
 		Renderer() = default;
 
@@ -50,20 +75,199 @@ export namespace druid::graphics
 
 		/// @brief Draw a filled axis-aligned rectangle.
 		///
+		/// Records into the attached command buffer when one is set; otherwise
+		/// forwards to the backend immediately.
+		///
 		/// @param x X-coordinate of the rectangle origin.
 		/// @param y Y-coordinate of the rectangle origin.
 		/// @param width Width of the rectangle.
 		/// @param height Height of the rectangle.
 		/// @param color Fill color of the rectangle.
-		virtual auto draw_rectangle(float x, float y, float width, float height, druid::graphics::Color color) -> void = 0;
+		auto draw_rectangle(float x, float y, float width, float height, druid::graphics::Color color) -> void
+		{
+			if (buffer_ != nullptr)
+			{
+				buffer_->record_rectangle(x, y, width, height, color);
+				return;
+			}
+
+			submit_rectangle(x, y, width, height, color);
+		}
 
 		/// @brief Draw a text string.
 		///
+		/// Records into the attached command buffer when one is set; otherwise
+		/// forwards to the backend immediately.
+		///
+		/// @param x X-coordinate of the text origin.
+		/// @param y Y-coordinate of the text origin.
+		/// @param text UTF-8 text string to render.
+		/// @param font_size Font size in pixels (or backend-defined units).
+		/// @param color Text color.
+		auto draw_text(float x, float y, const std::string& text, int font_size, druid::graphics::Color color) -> void
+		{
+			if (buffer_ != nullptr)
+			{
+				buffer_->record_text(x, y, text, font_size, color);
+				return;
+			}
+
+			submit_text(x, y, text, font_size, color);
+		}
+
+		/// @brief Draw a textured quad from a texture (atlas) sub-rectangle.
+		///
+		/// Records into the attached command buffer when one is set; otherwise
+		/// forwards to the backend immediately.
+		///
+		/// @param texture Texture to sample; typically a shared atlas page.
+		/// @param source_position Top-left of the sub-rectangle in texture pixels.
+		/// @param source_size Size of the sub-rectangle in texture pixels.
+		/// @param x X-coordinate of the quad origin.
+		/// @param y Y-coordinate of the quad origin.
+		/// @param width Width of the drawn quad.
+		/// @param height Height of the drawn quad.
+		/// @param tint Tint color multiplied with the texture.
+		auto draw_texture(TextureHandle texture, glm::vec2 source_position, glm::vec2 source_size, float x, float y, float width, float height,
+						  druid::graphics::Color tint) -> void
+		{
+			if (buffer_ != nullptr)
+			{
+				buffer_->record_texture(texture, source_position.x, source_position.y, source_size.x, source_size.y, x, y, width, height, tint);
+				return;
+			}
+
+			submit_texture(texture, source_position.x, source_position.y, source_size.x, source_size.y, x, y, width, height, tint);
+		}
+
+		/// @brief Load a texture from an image file.
+		///
+		/// The base implementation supports no textures and returns
+		/// `InvalidTexture`; GPU backends override it.
+		///
+		/// @param x Path to the image file.
+		/// @return Handle to the loaded texture, or `InvalidTexture` on failure.
+		[[nodiscard]] virtual auto load_texture(const std::filesystem::path& /*x*/) -> TextureHandle
+		{
+			return InvalidTexture;
+		}
+
+		/// @brief Release a texture loaded via `load_texture`.
+		/// @param x Texture to release; `InvalidTexture` is ignored.
+		virtual auto unload_texture(TextureHandle /*x*/) -> void
+		{
+		}
+
+		/// @brief Get a texture's dimensions.
+		/// @param x Texture to query.
+		/// @return Width and height in pixels; zero for unknown handles.
+		[[nodiscard]] virtual auto texture_size(TextureHandle /*x*/) const -> glm::vec2
+		{
+			return {};
+		}
+
+		/// @brief Submit a recorded command buffer to the backend.
+		///
+		/// The default implementation replays each command through the backend
+		/// draw hooks. Backends can override this to submit whole runs of
+		/// same-state commands in one pass.
+		///
+		/// @param x Command buffer to submit.
+		virtual auto submit(const CommandBuffer& x) -> void
+		{
+			for (const auto& command : x.commands())
+			{
+				switch (command.type)
+				{
+					case DrawCommand::Type::Rectangle:
+						submit_rectangle(command.x, command.y, command.width, command.height, command.color);
+						break;
+					case DrawCommand::Type::Text:
+						submit_text(command.x, command.y, x.text(command), command.font_size, command.color);
+						break;
+					case DrawCommand::Type::Texture:
+						submit_texture(command.texture, command.source_x, command.source_y, command.source_width, command.source_height, command.x,
+									   command.y, command.width, command.height, command.color);
+						break;
+				}
+			}
+		}
+
+		/// @brief Measure the rendered extents of a text string.
+		///
+		/// Lets layout code size and align text without drawing it. The base
+		/// implementation estimates a fixed glyph aspect; backends with real
+		/// font metrics should override it.
+		///
+		/// @param text UTF-8 text string to measure.
+		/// @param font_size Font size in pixels (or backend-defined units).
+		/// @return Width and height of the rendered text in pixels.
+		[[nodiscard]] virtual auto measure_text(std::string_view text, int font_size) const -> glm::vec2
+		{
+			return {static_cast<float>(text.size()) * static_cast<float>(font_size) * DefaultGlyphAspect, static_cast<float>(font_size)};
+		}
+
+		/// @brief Attach or detach the command buffer used for recording.
+		///
+		/// While a buffer is attached, `draw_rectangle`/`draw_text` record into
+		/// it instead of reaching the backend.
+		///
+		/// @param x Command buffer to record into, or nullptr for immediate mode.
+		auto set_command_buffer(CommandBuffer* x) noexcept -> void
+		{
+			buffer_ = x;
+		}
+
+		/// @brief Get the attached command buffer.
+		/// @return Pointer to the recording buffer, or nullptr in immediate mode.
+		[[nodiscard]] auto get_command_buffer() const noexcept -> CommandBuffer*
+		{
+			return buffer_;
+		}
+
+	protected:
+		/// @brief Backend hook: draw a filled rectangle.
+		///
+		/// @param x X-coordinate of the rectangle origin.
+		/// @param y Y-coordinate of the rectangle origin.
+		/// @param width Width of the rectangle.
+		/// @param height Height of the rectangle.
+		/// @param color Fill color of the rectangle.
+		virtual auto submit_rectangle(float x, float y, float width, float height, druid::graphics::Color color) -> void = 0;
+
+		/// @brief Backend hook: draw a text string.
+		///
+		/// The view's data is guaranteed null-terminated, so backends requiring
+		/// C strings can use `text.data()` directly.
+		///
 		/// @param x X-coordinate of the text origin.
 		/// @param y Y-coordinate of the text origin.
 		/// @param text UTF-8 text string to render.
 		/// @param font_size Font size in pixels (or backend-defined units).
 		/// @param color Text color.
-		virtual auto draw_text(float x, float y, const std::string& text, int font_size, druid::graphics::Color color) -> void = 0;
+		virtual auto submit_text(float x, float y, std::string_view text, int font_size, druid::graphics::Color color) -> void = 0;
+
+		/// @brief Backend hook: draw a textured quad from a texture sub-rectangle.
+		///
+		/// Defaults to a no-op so backends without texture support (headless,
+		/// test stubs) ignore sprite draws instead of having to stub them.
+		///
+		/// @param texture Texture to sample.
+		/// @param source_x Top-left X of the sub-rectangle in texture pixels.
+		/// @param source_y Top-left Y of the sub-rectangle in texture pixels.
+		/// @param source_width Width of the sub-rectangle in texture pixels.
+		/// @param source_height Height of the sub-rectangle in texture pixels.
+		/// @param x X-coordinate of the quad origin.
+		/// @param y Y-coordinate of the quad origin.
+		/// @param width Width of the drawn quad.
+		/// @param height Height of the drawn quad.
+		/// @param tint Tint color multiplied with the texture.
+		virtual auto submit_texture(TextureHandle /*texture*/, float /*source_x*/, float /*source_y*/, float /*source_width*/, float /*source_height*/,
+									float /*x*/, float /*y*/, float /*width*/, float /*height*/, druid::graphics::Color /*tint*/) -> void
+		{
+		}
+
+	private:
+		CommandBuffer* buffer_{};
 	};
 }
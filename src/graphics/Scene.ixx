@@ -0,0 +1,311 @@
+module;
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+export module druid.graphics.Scene;
+
+import druid.core.File;
+import druid.graphics.Color;
+import druid.graphics.Node;
+import druid.graphics.NodeRectangle;
+import druid.graphics.NodeText;
+
+export namespace druid::graphics
+{
+	/// @brief Magic number identifying a serialized scene ("DRSC").
+	constexpr auto SceneMagic{std::uint32_t{0x44525343}};
+	/// @brief Current scene format version.
+	constexpr auto SceneVersion{std::uint32_t{1}};
+
+	/// @enum SceneNodeType
+	/// @brief Concrete node type stored in a scene record.
+	enum class SceneNodeType : std::uint32_t
+	{
+		/// @brief Plain grouping node.
+		Node,
+		/// @brief NodeRectangle.
+		Rectangle,
+		/// @brief NodeText.
+		Text
+	};
+
+	/// @struct SceneHeader
+	/// @brief Fixed-size header at the front of a serialized scene.
+	struct SceneHeader
+	{
+		/// @brief Must equal `SceneMagic`.
+		std::uint32_t magic{SceneMagic};
+		/// @brief Must equal `SceneVersion`.
+		std::uint32_t version{SceneVersion};
+		/// @brief Number of node records following the header.
+		std::uint32_t count{};
+		/// @brief Size in bytes of the string pool following the records.
+		std::uint32_t text_bytes{};
+	};
+
+	/// @struct SceneNodeRecord
+	/// @brief One flat, trivially-copyable node record.
+	///
+	/// Records are stored in pre-order, so a node's parent always precedes it
+	/// and a single forward pass can instantiate the whole tree. Text payloads
+	/// live out-of-line in the string pool, referenced by offset and length.
+	struct SceneNodeRecord
+	{
+		/// @brief Concrete node type to instantiate.
+		SceneNodeType type{SceneNodeType::Node};
+		/// @brief Index of the parent record; equal to the own index for the root.
+		std::uint32_t parent{};
+		/// @brief Local position.
+		float position_x{};
+		/// @brief Local position.
+		float position_y{};
+		/// @brief Local scale.
+		float scale_x{1.0F};
+		/// @brief Local scale.
+		float scale_y{1.0F};
+		/// @brief Local rotation angle.
+		float rotation{};
+		/// @brief Rectangle size (rectangles only).
+		float size_x{};
+		/// @brief Rectangle size (rectangles only).
+		float size_y{};
+		/// @brief Packed RGBA color (rectangles and text).
+		std::uint8_t red{};
+		/// @brief Packed RGBA color.
+		std::uint8_t green{};
+		/// @brief Packed RGBA color.
+		std::uint8_t blue{};
+		/// @brief Packed RGBA color.
+		std::uint8_t alpha{};
+		/// @brief Font size (text only).
+		std::int32_t font_size{};
+		/// @brief Offset of the text payload in the string pool (text only).
+		std::uint32_t text_offset{};
+		/// @brief Length in bytes of the text payload (text only).
+		std::uint32_t text_length{};
+	};
+
+	/// @brief Serialize a node tree to the flat binary scene format.
+	///
+	/// Walks the tree in pre-order and emits one fixed-size record per node
+	/// plus a pooled string block, so the result round-trips through
+	/// `InstantiateScene` without any parsing.
+	///
+	/// @param x Root of the tree to serialize (itself included).
+	/// @return Serialized scene bytes.
+	[[nodiscard]] auto SerializeScene(const Node& x) -> std::vector<std::byte>
+	{
+		std::vector<SceneNodeRecord> records;
+		std::string pool;
+
+		const auto visit = [&records, &pool](const auto& self, const Node& node, std::uint32_t parent) -> void
+		{
+			const auto index = static_cast<std::uint32_t>(records.size());
+			SceneNodeRecord record{.parent = parent,
+								   .position_x = node.get_position().x,
+								   .position_y = node.get_position().y,
+								   .scale_x = node.get_scale().x,
+								   .scale_y = node.get_scale().y,
+								   .rotation = node.get_rotation()};
+
+			if (const auto* rectangle = dynamic_cast<const NodeRectangle*>(&node))
+			{
+				record.type = SceneNodeType::Rectangle;
+				record.size_x = rectangle->get_size().x;
+				record.size_y = rectangle->get_size().y;
+				record.red = rectangle->get_color().red();
+				record.green = rectangle->get_color().green();
+				record.blue = rectangle->get_color().blue();
+				record.alpha = rectangle->get_color().alpha();
+			}
+			else if (const auto* text = dynamic_cast<const NodeText*>(&node))
+			{
+				record.type = SceneNodeType::Text;
+				record.font_size = text->get_font_size();
+				record.red = text->get_color().red();
+				record.green = text->get_color().green();
+				record.blue = text->get_color().blue();
+				record.alpha = text->get_color().alpha();
+				record.text_offset = static_cast<std::uint32_t>(pool.size());
+				record.text_length = static_cast<std::uint32_t>(text->get_text().size());
+				pool.append(text->get_text());
+			}
+
+			records.push_back(record);
+
+			for (const auto& child : node.children())
+			{
+				self(self, *child, index);
+			}
+		};
+
+		visit(visit, x, 0);
+
+		const SceneHeader header{.count = static_cast<std::uint32_t>(records.size()), .text_bytes = static_cast<std::uint32_t>(pool.size())};
+
+		std::vector<std::byte> data(sizeof(SceneHeader) + (records.size() * sizeof(SceneNodeRecord)) + pool.size());
+		std::memcpy(data.data(), &header, sizeof(SceneHeader));
+		std::memcpy(data.data() + sizeof(SceneHeader), records.data(), records.size() * sizeof(SceneNodeRecord));
+		std::memcpy(data.data() + sizeof(SceneHeader) + (records.size() * sizeof(SceneNodeRecord)), pool.data(), pool.size());
+		return data;
+	}
+
+	/// @brief Instantiate a node tree from serialized scene bytes.
+	///
+	/// One forward pass over the records: each node is created and attached to
+	/// its already-instantiated parent, with no intermediate parse structures.
+	/// The view can come straight from a `FileMapping`, so records are
+	/// consumed directly from the mapped pages.
+	///
+	/// @param x Serialized scene bytes (e.g., `FileMapping::data()`).
+	/// @return Root of the instantiated tree, or nullptr if the data is malformed.
+	[[nodiscard]] auto InstantiateScene(std::span<const std::byte> x) -> std::unique_ptr<Node>
+	{
+		if (x.size() < sizeof(SceneHeader))
+		{
+			return nullptr;
+		}
+
+		SceneHeader header;
+		std::memcpy(&header, x.data(), sizeof(SceneHeader));
+
+		const auto expected = sizeof(SceneHeader) + (static_cast<std::size_t>(header.count) * sizeof(SceneNodeRecord)) + header.text_bytes;
+
+		if (header.magic != SceneMagic || header.version != SceneVersion || header.count == 0 || x.size() != expected)
+		{
+			return nullptr;
+		}
+
+		const auto records = x.subspan(sizeof(SceneHeader), static_cast<std::size_t>(header.count) * sizeof(SceneNodeRecord));
+		const auto pool = x.subspan(sizeof(SceneHeader) + records.size(), header.text_bytes);
+
+		std::unique_ptr<Node> root;
+		std::vector<Node*> nodes(header.count);
+
+		for (std::uint32_t i = 0; i < header.count; i++)
+		{
+			SceneNodeRecord record;
+			std::memcpy(&record, records.data() + (static_cast<std::size_t>(i) * sizeof(SceneNodeRecord)), sizeof(SceneNodeRecord));
+
+			if ((i == 0 && record.parent != 0) || (i > 0 && record.parent >= i))
+			{
+				return nullptr;
+			}
+
+			// The type drives instantiation switches below; an out-of-range
+			// value would match no case and leave the node null.
+			if (record.type > SceneNodeType::Text)
+			{
+				return nullptr;
+			}
+
+			// Checked as two comparisons: summing offset and length in
+			// 32 bits could wrap and slip a malformed range past the pool.
+			if (record.text_offset > header.text_bytes || record.text_length > header.text_bytes - record.text_offset)
+			{
+				return nullptr;
+			}
+
+			Node* node{};
+
+			if (i == 0)
+			{
+				switch (record.type)
+				{
+					case SceneNodeType::Rectangle:
+						root = std::make_unique<NodeRectangle>();
+						break;
+					case SceneNodeType::Text:
+						root = std::make_unique<NodeText>();
+						break;
+					case SceneNodeType::Node:
+						root = std::make_unique<Node>();
+						break;
+				}
+
+				node = root.get();
+			}
+			else
+			{
+				auto& parent = *nodes[record.parent];
+
+				switch (record.type)
+				{
+					case SceneNodeType::Rectangle:
+						node = &parent.create_node<NodeRectangle>();
+						break;
+					case SceneNodeType::Text:
+						node = &parent.create_node<NodeText>();
+						break;
+					case SceneNodeType::Node:
+						node = &parent.create_node();
+						break;
+				}
+			}
+
+			nodes[i] = node;
+			node->set_position({record.position_x, record.position_y});
+			node->set_scale({record.scale_x, record.scale_y});
+			node->set_rotation(record.rotation);
+
+			if (record.type == SceneNodeType::Rectangle)
+			{
+				auto& rectangle = static_cast<NodeRectangle&>(*node); // NOLINT (cppcoreguidelines-pro-type-static-cast-downcast)
+				rectangle.set_size({record.size_x, record.size_y});
+				rectangle.set_color(Rgba{.r = record.red, .g = record.green, .b = record.blue, .a = record.alpha});
+			}
+			else if (record.type == SceneNodeType::Text)
+			{
+				auto& text = static_cast<NodeText&>(*node); // NOLINT (cppcoreguidelines-pro-type-static-cast-downcast)
+				// NOLINTNEXTLINE (cppcoreguidelines-pro-type-reinterpret-cast)
+				text.set_text({reinterpret_cast<const char*>(pool.data()) + record.text_offset, record.text_length});
+				text.set_font_size(record.font_size);
+				text.set_color(Rgba{.r = record.red, .g = record.green, .b = record.blue, .a = record.alpha});
+			}
+		}
+
+		return root;
+	}
+
+	/// @brief Serialize a node tree and write it to a file.
+	///
+	/// @param x Root of the tree to serialize.
+	/// @param path Destination file path.
+	/// @return True if the file was written.
+	auto SaveScene(const Node& x, const std::filesystem::path& path) -> bool
+	{
+		const auto data = SerializeScene(x);
+		std::ofstream stream{path, std::ios::binary};
+
+		if (!stream.is_open())
+		{
+			return false;
+		}
+
+		// NOLINTNEXTLINE (cppcoreguidelines-pro-type-reinterpret-cast)
+		stream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+		return stream.good();
+	}
+
+	/// @brief Load a scene file and instantiate its node tree.
+	///
+	/// The file is memory-mapped, so node records fault in on demand and are
+	/// consumed in place — no bytes are copied before instantiation.
+	///
+	/// @param x Path to a file written by `SaveScene`.
+	/// @return Root of the instantiated tree, or nullptr on failure.
+	[[nodiscard]] auto LoadScene(const std::filesystem::path& x) -> std::unique_ptr<Node>
+	{
+		const druid::core::FileMapping mapping{x};
+		return InstantiateScene(mapping.data());
+	}
+}
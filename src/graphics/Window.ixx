@@ -34,6 +34,11 @@ export namespace druid::graphics
 		static constexpr auto DefaultWidth{1280};
 		/// @brief Default window height in pixels.
 		static constexpr auto DefaultHeight{720};
+		/// @brief Consecutive redraws scheduled per damage hit.
+		///
+		/// Covers double buffering: both swapchain images must be refreshed
+		/// after a change before frames can be skipped without flicker.
+		static constexpr auto RedrawFrames{2};
 
 		/// @brief Construct the window service and bind it to the engine.
 		/// @param x Owning engine instance.
@@ -88,6 +93,57 @@ export namespace druid::graphics
 			return title_;
 		}
 
+		/// @brief Request a redraw regardless of scene damage.
+		///
+		/// Use when something outside the scene graph changed (e.g. the window
+		/// was resized or exposed).
+		auto request_redraw() noexcept -> void
+		{
+			redraw_requested_ = true;
+		}
+
+		/// @brief Force a redraw every frame, disabling damage-based skipping.
+		///
+		/// For backends whose presentation requires continuous rendering.
+		///
+		/// @param x True to redraw unconditionally.
+		auto set_always_redraw(bool x) noexcept -> void
+		{
+			always_redraw_ = x;
+		}
+
+		/// @brief Decide whether this frame must be rendered, consuming damage.
+		///
+		/// Returns true when the scene is damaged, a redraw was requested, or
+		/// always-redraw is set. A damage hit schedules `RedrawFrames`
+		/// consecutive redraws so every buffer of a double-buffered swapchain
+		/// is refreshed before skipping resumes; a skip means the backend can
+		/// re-present the previous frame instead of traversing the scene.
+		///
+		/// @return True if the backend should render this frame.
+		[[nodiscard]] auto consume_redraw() -> bool
+		{
+			if (always_redraw_)
+			{
+				return true;
+			}
+
+			if (redraw_requested_ || root_node_.damaged())
+			{
+				redraw_requested_ = false;
+				root_node_.clear_damage();
+				pending_redraws_ = RedrawFrames;
+			}
+
+			if (pending_redraws_ > 0)
+			{
+				pending_redraws_--;
+				return true;
+			}
+
+			return false;
+		}
+
 		/// @brief Set the renderer for this window.
 		/// @param x The renderer to use for drawing.
 		auto set_renderer(std::unique_ptr<Renderer> x) -> void
@@ -106,5 +162,8 @@ export namespace druid::graphics
 		Node root_node_;
 		std::unique_ptr<Renderer> renderer_;
 		std::string title_{DefaultTitle};
+		int pending_redraws_{RedrawFrames};
+		bool redraw_requested_{false};
+		bool always_redraw_{false};
 	};
 }
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+import druid.graphics.Color;
+import druid.graphics.CommandBuffer;
+
+using druid::graphics::Color;
+using druid::graphics::CommandBuffer;
+using druid::graphics::DrawCommand;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+TEST(CommandBuffer, record_rectangle)
+{
+	CommandBuffer buffer;
+	buffer.record_rectangle(1.0F, 2.0F, 3.0F, 4.0F, Color::Red);
+
+	ASSERT_EQ(buffer.size(), 1U);
+
+	const auto& command = buffer.commands().front();
+	EXPECT_EQ(command.type, DrawCommand::Type::Rectangle);
+	EXPECT_FLOAT_EQ(command.x, 1.0F);
+	EXPECT_FLOAT_EQ(command.y, 2.0F);
+	EXPECT_FLOAT_EQ(command.width, 3.0F);
+	EXPECT_FLOAT_EQ(command.height, 4.0F);
+}
+
+TEST(CommandBuffer, record_text_pools_payload)
+{
+	CommandBuffer buffer;
+	buffer.record_text(0.0F, 0.0F, "one", 20, Color::White);
+	buffer.record_text(0.0F, 0.0F, "two", 20, Color::White);
+
+	ASSERT_EQ(buffer.size(), 2U);
+	EXPECT_EQ(buffer.text(buffer.commands()[0]), "one");
+	EXPECT_EQ(buffer.text(buffer.commands()[1]), "two");
+
+	// Pooled text is null-terminated for C-string backends.
+	EXPECT_EQ(buffer.text(buffer.commands()[0]).data()[3], '\0');
+}
+
+TEST(CommandBuffer, sort_groups_by_type_and_color)
+{
+	CommandBuffer buffer;
+	buffer.record_text(0.0F, 0.0F, "label", 20, Color::White);
+	buffer.record_rectangle(0.0F, 0.0F, 1.0F, 1.0F, Color::Blue);
+	buffer.record_rectangle(0.0F, 0.0F, 1.0F, 1.0F, Color::Red);
+	buffer.record_rectangle(0.0F, 0.0F, 1.0F, 1.0F, Color::Blue);
+
+	buffer.sort();
+
+	const auto commands = buffer.commands();
+	ASSERT_EQ(commands.size(), 4U);
+
+	// Rectangles first, grouped by color; text last.
+	EXPECT_EQ(commands[0].type, DrawCommand::Type::Rectangle);
+	EXPECT_EQ(commands[1].type, DrawCommand::Type::Rectangle);
+	EXPECT_EQ(commands[2].type, DrawCommand::Type::Rectangle);
+	EXPECT_EQ(commands[3].type, DrawCommand::Type::Text);
+	EXPECT_EQ(commands[0].color.blue(), commands[1].color.blue());
+}
+
+TEST(CommandBuffer, record_texture)
+{
+	CommandBuffer buffer;
+	buffer.record_texture(3U, 32.0F, 0.0F, 16.0F, 16.0F, 10.0F, 20.0F, 16.0F, 16.0F, Color::White);
+
+	const auto commands = buffer.commands();
+	ASSERT_EQ(commands.size(), 1U);
+	EXPECT_EQ(commands[0].type, DrawCommand::Type::Texture);
+	EXPECT_EQ(commands[0].texture, 3U);
+	EXPECT_EQ(commands[0].source_x, 32.0F);
+	EXPECT_EQ(commands[0].source_width, 16.0F);
+	EXPECT_EQ(commands[0].x, 10.0F);
+	EXPECT_EQ(commands[0].y, 20.0F);
+}
+
+TEST(CommandBuffer, sort_groups_same_texture_runs)
+{
+	CommandBuffer buffer;
+	buffer.record_texture(2U, 0.0F, 0.0F, 8.0F, 8.0F, 0.0F, 0.0F, 8.0F, 8.0F, Color::White);
+	buffer.record_texture(1U, 0.0F, 0.0F, 8.0F, 8.0F, 0.0F, 0.0F, 8.0F, 8.0F, Color::White);
+	buffer.record_texture(2U, 8.0F, 0.0F, 8.0F, 8.0F, 0.0F, 0.0F, 8.0F, 8.0F, Color::White);
+	buffer.record_texture(1U, 8.0F, 0.0F, 8.0F, 8.0F, 0.0F, 0.0F, 8.0F, 8.0F, Color::White);
+
+	buffer.sort();
+
+	// Sprites sharing an atlas page become one contiguous run.
+	const auto commands = buffer.commands();
+	ASSERT_EQ(commands.size(), 4U);
+	EXPECT_EQ(commands[0].texture, 1U);
+	EXPECT_EQ(commands[1].texture, 1U);
+	EXPECT_EQ(commands[2].texture, 2U);
+	EXPECT_EQ(commands[3].texture, 2U);
+	// Stable sort keeps recording order within a run.
+	EXPECT_EQ(commands[0].source_x, 0.0F);
+	EXPECT_EQ(commands[1].source_x, 8.0F);
+}
+
+TEST(CommandBuffer, clear)
+{
+	CommandBuffer buffer;
+	buffer.record_rectangle(0.0F, 0.0F, 1.0F, 1.0F, Color::Red);
+	buffer.clear();
+	EXPECT_TRUE(buffer.empty());
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
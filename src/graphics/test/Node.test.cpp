@@ -1,12 +1,46 @@
 #include <gtest/gtest.h>
 #include <glm/glm.hpp>
+#include <string_view>
 
+import druid.graphics.Color;
 import druid.graphics.Node;
+import druid.graphics.NodeRectangle;
+import druid.graphics.Renderer;
 
+using druid::graphics::Bounds;
 using druid::graphics::Node;
+using druid::graphics::NodeRectangle;
 
 // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
 
+namespace
+{
+	/// @brief Renderer stub that counts submitted rectangles.
+	class CountingRenderer final : public druid::graphics::Renderer
+	{
+	public:
+		int rectangles{};
+
+	private:
+		auto begin(druid::graphics::Color /*clear*/) -> void override
+		{
+		}
+
+		auto end() -> void override
+		{
+		}
+
+		auto submit_rectangle(float /*x*/, float /*y*/, float /*width*/, float /*height*/, druid::graphics::Color /*color*/) -> void override
+		{
+			rectangles++;
+		}
+
+		auto submit_text(float /*x*/, float /*y*/, std::string_view /*text*/, int /*font_size*/, druid::graphics::Color /*color*/) -> void override
+		{
+		}
+	};
+}
+
 TEST(Node, default_constructor)
 {
 	auto node = std::make_unique<Node>();
@@ -63,6 +97,180 @@ TEST(Node, set_and_get_scale)
 	// NOLINTEND
 }
 
+TEST(Node, global_position_composes_parents)
+{
+	auto root = std::make_unique<Node>();
+	root->set_position({10.0F, 20.0F});
+
+	auto& child = root->create_node();
+	child.set_position({1.0F, 2.0F});
+
+	const auto pos = child.get_position_global();
+	EXPECT_FLOAT_EQ(pos.x, 11.0F);
+	EXPECT_FLOAT_EQ(pos.y, 22.0F);
+
+	// Batch propagation must agree with lazy evaluation after a change.
+	root->set_position({0.0F, 0.0F});
+	root->propagate_transforms();
+
+	const auto moved = child.get_position_global();
+	EXPECT_FLOAT_EQ(moved.x, 1.0F);
+	EXPECT_FLOAT_EQ(moved.y, 2.0F);
+}
+
+TEST(Node, subtree_bounds_aggregates_children)
+{
+	auto root = std::make_unique<Node>();
+
+	auto& rect = root->create_node<NodeRectangle>();
+	rect.set_size({10.0F, 10.0F});
+	rect.set_position({100.0F, 100.0F});
+
+	const auto& bounds = root->subtree_bounds();
+	ASSERT_TRUE(bounds.valid());
+	EXPECT_FLOAT_EQ(bounds.min.x, 95.0F);
+	EXPECT_FLOAT_EQ(bounds.max.y, 105.0F);
+}
+
+TEST(Node, draw_culls_offscreen_subtrees)
+{
+	auto root = std::make_unique<Node>();
+	constexpr Bounds viewport{.min = {0.0F, 0.0F}, .max = {100.0F, 100.0F}};
+
+	auto& visible = root->create_node<NodeRectangle>();
+	visible.set_size({10.0F, 10.0F});
+	visible.set_position({50.0F, 50.0F});
+
+	auto& offscreen = root->create_node<NodeRectangle>();
+	offscreen.set_size({10.0F, 10.0F});
+	offscreen.set_position({500.0F, 500.0F});
+
+	CountingRenderer renderer;
+	root->draw(renderer, viewport);
+	EXPECT_EQ(renderer.rectangles, 1);
+
+	// Moving the culled subtree into view must invalidate its cached bounds.
+	offscreen.set_position({60.0F, 60.0F});
+	renderer.rectangles = 0;
+	root->draw(renderer, viewport);
+	EXPECT_EQ(renderer.rectangles, 2);
+}
+
+TEST(Node, damage_tracking)
+{
+	auto root = std::make_unique<Node>();
+	EXPECT_TRUE(root->damaged());
+	root->clear_damage();
+	EXPECT_FALSE(root->damaged());
+
+	auto& child = root->create_node<NodeRectangle>();
+	EXPECT_TRUE(root->damaged());
+	root->clear_damage();
+
+	child.set_position({1.0F, 1.0F});
+	EXPECT_TRUE(root->damaged());
+	root->clear_damage();
+
+	// Visual-only changes must damage the tree too.
+	child.set_color(druid::graphics::Color::Red);
+	EXPECT_TRUE(root->damaged());
+}
+
+TEST(Node, detach_updates_draw_and_bounds_caches)
+{
+	CountingRenderer renderer;
+	auto root = std::make_unique<Node>();
+
+	auto& kept = root->create_node<NodeRectangle>();
+	kept.set_size({10.0F, 10.0F});
+	auto& doomed = root->create_node<NodeRectangle>();
+	doomed.set_size({10.0F, 10.0F});
+
+	root->draw(renderer);
+	EXPECT_EQ(renderer.rectangles, 2);
+
+	// Detached subtrees must leave the flattened cache and hit testing.
+	auto owned = doomed.detach();
+	ASSERT_NE(owned, nullptr);
+	EXPECT_EQ(root->children().size(), 1);
+
+	renderer.rectangles = 0;
+	root->draw(renderer);
+	EXPECT_EQ(renderer.rectangles, 1);
+}
+
+TEST(Node, pick_returns_topmost_hit)
+{
+	auto root = std::make_unique<Node>();
+
+	auto& below = root->create_node<NodeRectangle>();
+	below.set_position({50.0F, 50.0F});
+	below.set_size({40.0F, 40.0F});
+
+	auto& above = root->create_node<NodeRectangle>();
+	above.set_position({60.0F, 60.0F});
+	above.set_size({40.0F, 40.0F});
+
+	// Overlap region: the child drawn last wins.
+	EXPECT_EQ(root->pick({55.0F, 55.0F}), &above);
+	// Only the lower rectangle covers its far corner.
+	EXPECT_EQ(root->pick({35.0F, 35.0F}), &below);
+	// Empty space hits nothing.
+	EXPECT_EQ(root->pick({200.0F, 200.0F}), nullptr);
+}
+
+TEST(Node, pick_tracks_moved_nodes)
+{
+	auto root = std::make_unique<Node>();
+
+	auto& rectangle = root->create_node<NodeRectangle>();
+	rectangle.set_position({10.0F, 10.0F});
+	rectangle.set_size({10.0F, 10.0F});
+
+	EXPECT_EQ(root->pick({10.0F, 10.0F}), &rectangle);
+
+	// Moving the node must invalidate the cached bounds the descent uses.
+	rectangle.set_position({100.0F, 100.0F});
+	EXPECT_EQ(root->pick({10.0F, 10.0F}), nullptr);
+	EXPECT_EQ(root->pick({100.0F, 100.0F}), &rectangle);
+}
+
+TEST(Node, pick_composes_parent_transforms)
+{
+	auto root = std::make_unique<Node>();
+	root->set_position({100.0F, 0.0F});
+
+	auto& rectangle = root->create_node<NodeRectangle>();
+	rectangle.set_position({10.0F, 10.0F});
+	rectangle.set_size({4.0F, 4.0F});
+
+	EXPECT_EQ(root->pick({110.0F, 10.0F}), &rectangle);
+	EXPECT_EQ(root->pick({10.0F, 10.0F}), nullptr);
+}
+
+TEST(Node, mat4_conversion_matches_affine)
+{
+	auto root = std::make_unique<Node>();
+	root->set_position({10.0F, 20.0F});
+
+	auto& child = root->create_node();
+	child.set_position({5.0F, -5.0F});
+	child.set_scale({2.0F, 3.0F});
+
+	// The on-demand mat4 is just the global affine expanded to 4x4.
+	const auto matrix = child.transform_global();
+	const auto& affine = child.affine_global();
+
+	EXPECT_FLOAT_EQ(matrix[0][0], affine.a);
+	EXPECT_FLOAT_EQ(matrix[0][1], affine.b);
+	EXPECT_FLOAT_EQ(matrix[1][0], affine.c);
+	EXPECT_FLOAT_EQ(matrix[1][1], affine.d);
+	EXPECT_FLOAT_EQ(matrix[3][0], 15.0F);
+	EXPECT_FLOAT_EQ(matrix[3][1], 15.0F);
+	EXPECT_FLOAT_EQ(matrix[2][2], 1.0F);
+	EXPECT_FLOAT_EQ(matrix[3][3], 1.0F);
+}
+
 TEST(Node, set_and_get_rotation)
 {
 	auto node = std::make_unique<Node>();
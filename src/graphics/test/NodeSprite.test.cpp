@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <glm/glm.hpp>
+
+#include <memory>
+#include <string_view>
+
+import druid.graphics.Color;
+import druid.graphics.Node;
+import druid.graphics.NodeSprite;
+import druid.graphics.Renderer;
+
+using druid::graphics::Color;
+using druid::graphics::Node;
+using druid::graphics::NodeSprite;
+using druid::graphics::TextureHandle;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+namespace
+{
+	class SpriteRenderer : public druid::graphics::Renderer
+	{
+	public:
+		auto begin(Color /*clear*/) -> void override
+		{
+		}
+
+		auto end() -> void override
+		{
+		}
+
+		int sprites{};
+		TextureHandle texture{};
+		glm::vec2 source_position{};
+		glm::vec2 source_size{};
+		glm::vec2 position{};
+		glm::vec2 size{};
+
+	protected:
+		auto submit_rectangle(float /*x*/, float /*y*/, float /*width*/, float /*height*/, Color /*color*/) -> void override
+		{
+		}
+
+		auto submit_text(float /*x*/, float /*y*/, std::string_view /*text*/, int /*font_size*/, Color /*color*/) -> void override
+		{
+		}
+
+		auto submit_texture(TextureHandle texture_in, float source_x, float source_y, float source_width, float source_height, float x, float y,
+							float width, float height, Color /*tint*/) -> void override
+		{
+			this->sprites++;
+			this->texture = texture_in;
+			this->source_position = {source_x, source_y};
+			this->source_size = {source_width, source_height};
+			this->position = {x, y};
+			this->size = {width, height};
+		}
+	};
+}
+
+TEST(NodeSprite, draws_atlas_subrectangle)
+{
+	SpriteRenderer renderer;
+	auto root = std::make_unique<Node>();
+
+	auto& sprite = root->create_node<NodeSprite>();
+	sprite.set_texture(TextureHandle{7});
+	sprite.set_source({32.0F, 64.0F}, {16.0F, 16.0F});
+	sprite.set_position({100.0F, 100.0F});
+
+	root->draw(renderer);
+
+	EXPECT_EQ(renderer.sprites, 1);
+	EXPECT_EQ(renderer.texture, TextureHandle{7});
+	EXPECT_EQ(renderer.source_position.x, 32.0F);
+	EXPECT_EQ(renderer.source_size.x, 16.0F);
+	// Drawn centered at native source size: 100 - 16/2.
+	EXPECT_EQ(renderer.position.x, 92.0F);
+	EXPECT_EQ(renderer.size.x, 16.0F);
+}
+
+TEST(NodeSprite, size_override_scales_quad)
+{
+	SpriteRenderer renderer;
+	auto root = std::make_unique<Node>();
+
+	auto& sprite = root->create_node<NodeSprite>();
+	sprite.set_texture(TextureHandle{1});
+	sprite.set_source({0.0F, 0.0F}, {8.0F, 8.0F});
+	sprite.set_size({32.0F, 32.0F});
+
+	root->draw(renderer);
+
+	EXPECT_EQ(renderer.size.x, 32.0F);
+	EXPECT_EQ(renderer.size.y, 32.0F);
+	EXPECT_EQ(renderer.position.x, -16.0F);
+
+	const auto bounds = sprite.local_bounds();
+	EXPECT_EQ(bounds.min.x, -16.0F);
+	EXPECT_EQ(bounds.max.x, 16.0F);
+}
+
+TEST(NodeSprite, without_texture_draws_nothing)
+{
+	SpriteRenderer renderer;
+	auto root = std::make_unique<Node>();
+
+	auto& sprite = root->create_node<NodeSprite>();
+	sprite.set_source({0.0F, 0.0F}, {8.0F, 8.0F});
+
+	root->draw(renderer);
+	EXPECT_EQ(renderer.sprites, 0);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+import druid.graphics.Color;
+import druid.graphics.CommandBuffer;
+import druid.graphics.Renderer;
+import druid.graphics.RenderThread;
+
+using druid::graphics::Color;
+using druid::graphics::CommandBuffer;
+using druid::graphics::Renderer;
+using druid::graphics::RenderThread;
+
+namespace
+{
+	/// Records every submission on the render thread. Reads from the test
+	/// thread happen after `wait_idle`, whose mutex orders them after the
+	/// render thread's writes.
+	class RecordingRenderer : public Renderer
+	{
+	public:
+		auto begin(Color /*clear*/) -> void override
+		{
+			this->begins++;
+		}
+
+		auto end() -> void override
+		{
+			this->ends++;
+		}
+
+		int begins{};
+		int ends{};
+		std::vector<float> rectangles;
+		std::vector<std::string> texts;
+
+	protected:
+		auto submit_rectangle(float x, float /*y*/, float /*width*/, float /*height*/, Color /*color*/) -> void override
+		{
+			this->rectangles.push_back(x);
+		}
+
+		auto submit_text(float /*x*/, float /*y*/, std::string_view text, int /*font_size*/, Color /*color*/) -> void override
+		{
+			this->texts.emplace_back(text);
+		}
+	};
+}
+
+TEST(RenderThread, submits_presented_frame)
+{
+	RecordingRenderer renderer;
+
+	{
+		RenderThread thread{renderer};
+
+		auto& buffer = thread.record();
+		buffer.record_rectangle(1.0F, 2.0F, 3.0F, 4.0F, Color::Red);
+		buffer.record_text(5.0F, 6.0F, "druid", 20, Color::White);
+
+		thread.present(Color::Black);
+		thread.wait_idle();
+	}
+
+	EXPECT_EQ(renderer.begins, 1);
+	EXPECT_EQ(renderer.ends, 1);
+	ASSERT_EQ(renderer.rectangles.size(), 1);
+	EXPECT_EQ(renderer.rectangles.front(), 1.0F);
+	ASSERT_EQ(renderer.texts.size(), 1);
+	EXPECT_EQ(renderer.texts.front(), "druid");
+}
+
+TEST(RenderThread, present_clears_recording_buffer)
+{
+	RecordingRenderer renderer;
+	RenderThread thread{renderer};
+
+	thread.record().record_rectangle(0.0F, 0.0F, 10.0F, 10.0F, Color::Red);
+	EXPECT_EQ(thread.record().size(), 1);
+
+	thread.present(Color::Black);
+	EXPECT_TRUE(thread.record().empty());
+}
+
+TEST(RenderThread, pipelines_consecutive_frames)
+{
+	RecordingRenderer renderer;
+
+	{
+		RenderThread thread{renderer};
+
+		for (auto frame = 0; frame < 3; frame++)
+		{
+			thread.record().record_rectangle(static_cast<float>(frame), 0.0F, 1.0F, 1.0F, Color::Red);
+			thread.present(Color::Black);
+		}
+
+		thread.wait_idle();
+	}
+
+	EXPECT_EQ(renderer.begins, 3);
+	EXPECT_EQ(renderer.ends, 3);
+	ASSERT_EQ(renderer.rectangles.size(), 3);
+	EXPECT_EQ(renderer.rectangles[0], 0.0F);
+	EXPECT_EQ(renderer.rectangles[1], 1.0F);
+	EXPECT_EQ(renderer.rectangles[2], 2.0F);
+}
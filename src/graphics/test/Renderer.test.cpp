@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <string_view>
+
+import druid.graphics.Color;
+import druid.graphics.Renderer;
+
+namespace
+{
+	/// @brief Minimal concrete renderer exposing the base-class behavior.
+	class StubRenderer final : public druid::graphics::Renderer
+	{
+		auto begin(druid::graphics::Color /*clear*/) -> void override
+		{
+		}
+
+		auto end() -> void override
+		{
+		}
+
+		auto submit_rectangle(float /*x*/, float /*y*/, float /*width*/, float /*height*/, druid::graphics::Color /*color*/) -> void override
+		{
+		}
+
+		auto submit_text(float /*x*/, float /*y*/, std::string_view /*text*/, int /*font_size*/, druid::graphics::Color /*color*/) -> void override
+		{
+		}
+	};
+}
+
+TEST(Renderer, measure_text_scales_with_length_and_size)
+{
+	const StubRenderer renderer;
+
+	const auto small = renderer.measure_text("ab", 20);
+	const auto longer = renderer.measure_text("abcd", 20);
+	const auto bigger = renderer.measure_text("ab", 40);
+
+	EXPECT_GT(longer.x, small.x);
+	EXPECT_GT(bigger.x, small.x);
+	EXPECT_FLOAT_EQ(small.y, 20.0F);
+	EXPECT_FLOAT_EQ(bigger.y, 40.0F);
+}
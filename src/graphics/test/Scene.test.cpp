@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+import druid.graphics.Color;
+import druid.graphics.Node;
+import druid.graphics.NodeRectangle;
+import druid.graphics.NodeText;
+import druid.graphics.Scene;
+
+using druid::graphics::Node;
+using druid::graphics::NodeRectangle;
+using druid::graphics::NodeText;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+namespace
+{
+	auto make_scene() -> std::unique_ptr<Node>
+	{
+		auto root = std::make_unique<Node>();
+		root->set_position({10.0F, 20.0F});
+
+		auto& rectangle = root->create_node<NodeRectangle>();
+		rectangle.set_position({5.0F, 5.0F});
+		rectangle.set_size({100.0F, 50.0F});
+		rectangle.set_color(druid::graphics::Color::Red);
+
+		auto& text = rectangle.create_node<NodeText>();
+		text.set_text("score");
+		text.set_font_size(32);
+		text.set_rotation(45.0F);
+
+		return root;
+	}
+}
+
+TEST(Scene, round_trip)
+{
+	const auto original = make_scene();
+	const auto data = druid::graphics::SerializeScene(*original);
+	ASSERT_FALSE(data.empty());
+
+	const auto loaded = druid::graphics::InstantiateScene(data);
+	ASSERT_NE(loaded, nullptr);
+	EXPECT_EQ(loaded->get_position().x, 10.0F);
+	EXPECT_EQ(loaded->get_position().y, 20.0F);
+
+	ASSERT_EQ(loaded->children().size(), 1);
+	const auto* rectangle = dynamic_cast<const NodeRectangle*>(loaded->children().front().get());
+	ASSERT_NE(rectangle, nullptr);
+	EXPECT_EQ(rectangle->get_size().x, 100.0F);
+	EXPECT_EQ(rectangle->get_size().y, 50.0F);
+	EXPECT_EQ(rectangle->get_color().red(), druid::graphics::Color::Red.red());
+
+	ASSERT_EQ(rectangle->children().size(), 1);
+	const auto* text = dynamic_cast<const NodeText*>(rectangle->children().front().get());
+	ASSERT_NE(text, nullptr);
+	EXPECT_EQ(text->get_text(), "score");
+	EXPECT_EQ(text->get_font_size(), 32);
+	EXPECT_EQ(text->get_rotation(), 45.0F);
+}
+
+TEST(Scene, save_and_load_file)
+{
+	const auto path = std::filesystem::temp_directory_path() / "druid-scene-test.bin";
+	const auto original = make_scene();
+
+	ASSERT_TRUE(druid::graphics::SaveScene(*original, path));
+
+	const auto loaded = druid::graphics::LoadScene(path);
+	ASSERT_NE(loaded, nullptr);
+	ASSERT_EQ(loaded->children().size(), 1);
+
+	std::filesystem::remove(path);
+}
+
+TEST(Scene, rejects_malformed_data)
+{
+	EXPECT_EQ(druid::graphics::InstantiateScene({}), nullptr);
+
+	const std::vector<std::byte> garbage(64);
+	EXPECT_EQ(druid::graphics::InstantiateScene(garbage), nullptr);
+
+	// Truncated valid data must be rejected, not read out of bounds.
+	const auto original = make_scene();
+	auto data = druid::graphics::SerializeScene(*original);
+	data.pop_back();
+	EXPECT_EQ(druid::graphics::InstantiateScene(data), nullptr);
+}
+
+TEST(Scene, rejects_wrapping_text_range)
+{
+	const auto original = make_scene();
+	auto data = druid::graphics::SerializeScene(*original);
+
+	// Patch the text record so offset + length wraps past 2^32; the
+	// validation must not be fooled by the overflowing sum.
+	const auto position = sizeof(druid::graphics::SceneHeader) + (2 * sizeof(druid::graphics::SceneNodeRecord));
+	druid::graphics::SceneNodeRecord record;
+	std::memcpy(&record, data.data() + position, sizeof(record));
+	ASSERT_EQ(record.type, druid::graphics::SceneNodeType::Text);
+
+	record.text_offset = 0xFFFFFFF0U;
+	std::memcpy(data.data() + position, &record, sizeof(record));
+	EXPECT_EQ(druid::graphics::InstantiateScene(data), nullptr);
+}
+
+TEST(Scene, rejects_unknown_node_type)
+{
+	const auto original = make_scene();
+	auto data = druid::graphics::SerializeScene(*original);
+
+	// A type outside the known set must be rejected, not instantiated as
+	// nothing and then dereferenced.
+	const auto position = sizeof(druid::graphics::SceneHeader);
+	druid::graphics::SceneNodeRecord record;
+	std::memcpy(&record, data.data() + position, sizeof(record));
+
+	record.type = static_cast<druid::graphics::SceneNodeType>(0xFFU);
+	std::memcpy(data.data() + position, &record, sizeof(record));
+	EXPECT_EQ(druid::graphics::InstantiateScene(data), nullptr);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
@@ -0,0 +1,54 @@
+module;
+
+#include <string_view>
+
+export module druid.headless.Renderer;
+
+import druid.graphics.Color;
+import druid.graphics.Renderer;
+
+export namespace druid::headless
+{
+	/// @class Renderer
+	/// @brief Null implementation of the Renderer interface.
+	///
+	/// Every draw call is accepted and discarded. This lets the full draw
+	/// traversal run — draw callbacks fire, command buffers record — without
+	/// a GPU context, for server-side simulation and automated tests.
+	class Renderer : public druid::graphics::Renderer
+	{
+	public:
+		/// @brief Default constructor.
+		Renderer() = default;
+
+		/// @brief Virtual destructor.
+		~Renderer() override = default;
+
+		Renderer(const Renderer&) = delete;
+		Renderer(Renderer&&) noexcept = delete;
+		auto operator=(const Renderer&) -> Renderer& = delete;
+		auto operator=(Renderer&&) noexcept -> Renderer& = delete;
+
+		/// @brief Begin a frame (no-op).
+		/// @param clear Ignored.
+		auto begin(druid::graphics::Color /*clear*/) -> void override
+		{
+		}
+
+		/// @brief End a frame (no-op).
+		auto end() -> void override
+		{
+		}
+
+	protected:
+		/// @brief Discard a rectangle draw.
+		auto submit_rectangle(float /*x*/, float /*y*/, float /*width*/, float /*height*/, druid::graphics::Color /*color*/) -> void override
+		{
+		}
+
+		/// @brief Discard a text draw.
+		auto submit_text(float /*x*/, float /*y*/, std::string_view /*text*/, int /*font_size*/, druid::graphics::Color /*color*/) -> void override
+		{
+		}
+	};
+}
@@ -0,0 +1,95 @@
+module;
+
+#include <chrono>
+#include <memory>
+
+export module druid.headless.Window;
+
+import druid.core.Engine;
+import druid.graphics.Color;
+import druid.graphics.RenderThread;
+import druid.graphics.Window;
+import druid.headless.Renderer;
+
+export namespace druid::headless
+{
+	/// @class Window
+	/// @brief Windowless implementation of the Window service.
+	///
+	/// Creates no OS window and no GPU context: the scene graph, draw
+	/// traversal, and renderer interface all behave as usual against the
+	/// headless null renderer. Combined with the engine's deterministic tick
+	/// mode this runs gameplay code server-side at maximum throughput.
+	class Window : public druid::graphics::Window
+	{
+	public:
+		/// @brief Construct the headless window service.
+		/// @param x Owning engine instance.
+		explicit Window(druid::core::Engine& x) : druid::graphics::Window{x}
+		{
+			set_renderer(std::make_unique<druid::headless::Renderer>());
+		}
+
+		/// @brief Virtual destructor.
+		~Window() override = default;
+
+		Window(const Window&) = delete;
+		Window(Window&&) noexcept = delete;
+		auto operator=(const Window&) -> Window& = delete;
+		auto operator=(Window&&) noexcept -> Window& = delete;
+
+		/// @brief Per-frame update hook (no input to poll).
+		auto update(std::chrono::steady_clock::duration /*x*/) -> void override
+		{
+		}
+
+		/// @brief Toggle pipelined submission on a dedicated render thread.
+		///
+		/// When enabled, `update_end` records the scene into a command buffer
+		/// and hands it to a `RenderThread`, which sorts and submits it while
+		/// the next simulation step runs.
+		///
+		/// @param x True to render on a dedicated thread.
+		auto set_render_thread(bool x) -> void
+		{
+			if (x && render_thread_ == nullptr && get_renderer() != nullptr)
+			{
+				render_thread_ = std::make_unique<druid::graphics::RenderThread>(*get_renderer());
+			}
+			else if (!x)
+			{
+				render_thread_ = nullptr;
+			}
+		}
+
+		/// @brief End-of-frame hook: run the draw traversal against the null renderer.
+		///
+		/// Damage-based skipping applies here as well, so a static scene costs
+		/// nothing per frame.
+		auto update_end() -> void override
+		{
+			auto* renderer = get_renderer();
+
+			if (renderer == nullptr || !consume_redraw())
+			{
+				return;
+			}
+
+			if (render_thread_ != nullptr)
+			{
+				renderer->set_command_buffer(&render_thread_->record());
+				root_node().draw(*renderer);
+				renderer->set_command_buffer(nullptr);
+				render_thread_->present(druid::graphics::Color::Black);
+				return;
+			}
+
+			renderer->begin(druid::graphics::Color::Black);
+			root_node().draw(*renderer);
+			renderer->end();
+		}
+
+	private:
+		std::unique_ptr<druid::graphics::RenderThread> render_thread_;
+	};
+}
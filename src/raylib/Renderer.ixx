@@ -1,11 +1,20 @@
 module;
 
 #include <raylib.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <glm/glm.hpp>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 
 export module druid.raylib.Renderer;
 
 import druid.graphics.Color;
+import druid.graphics.CommandBuffer;
 import druid.graphics.Renderer;
 
 export namespace druid::raylib
@@ -23,11 +32,25 @@ export namespace druid::raylib
 	class Renderer : public druid::graphics::Renderer
 	{
 	public:
+		/// @brief Maximum number of cached text textures before pruning.
+		static constexpr std::size_t TextCacheCapacity{256};
+
 		/// @brief Default constructor.
 		Renderer() = default;
 
-		/// @brief Virtual destructor.
-		~Renderer() override = default;
+		/// @brief Virtual destructor. Releases all loaded and cached textures.
+		~Renderer() override
+		{
+			for (auto& [key, entry] : text_cache_)
+			{
+				UnloadRenderTexture(entry.texture);
+			}
+
+			for (auto& [handle, texture] : textures_)
+			{
+				UnloadTexture(texture);
+			}
+		}
 
 		Renderer(const Renderer&) = delete;
 		Renderer(Renderer&&) noexcept = delete;
@@ -56,8 +79,98 @@ export namespace druid::raylib
 		{
 			DrawFPS(0, 0);
 			EndDrawing();
+
+			frame_++;
+			prune_text_cache();
+		}
+
+		/// @brief Measure text using raylib's font metrics.
+		///
+		/// @param text UTF-8 text string to measure. The view's data must be null-terminated.
+		/// @param font_size Font size in pixels.
+		/// @return Width and height of the rendered text in pixels.
+		[[nodiscard]] auto measure_text(std::string_view text, int font_size) const -> glm::vec2 override
+		{
+			return {static_cast<float>(MeasureText(text.data(), font_size)), static_cast<float>(font_size)};
 		}
 
+		/// @brief Load a texture from an image file onto the GPU.
+		///
+		/// @param x Path to the image file.
+		/// @return Handle to the loaded texture, or `InvalidTexture` on failure.
+		[[nodiscard]] auto load_texture(const std::filesystem::path& x) -> druid::graphics::TextureHandle override
+		{
+			const auto texture = LoadTexture(x.string().c_str());
+
+			if (texture.id == 0)
+			{
+				return druid::graphics::InvalidTexture;
+			}
+
+			const auto handle = next_texture_++;
+			textures_.emplace(handle, texture);
+			return handle;
+		}
+
+		/// @brief Release a texture loaded via `load_texture`.
+		/// @param x Texture to release; unknown handles are ignored.
+		auto unload_texture(druid::graphics::TextureHandle x) -> void override
+		{
+			const auto it = textures_.find(x);
+
+			if (it != textures_.end())
+			{
+				UnloadTexture(it->second);
+				textures_.erase(it);
+			}
+		}
+
+		/// @brief Get a texture's dimensions.
+		/// @param x Texture to query.
+		/// @return Width and height in pixels; zero for unknown handles.
+		[[nodiscard]] auto texture_size(druid::graphics::TextureHandle x) const -> glm::vec2 override
+		{
+			const auto it = textures_.find(x);
+
+			if (it == textures_.end())
+			{
+				return {};
+			}
+
+			return {static_cast<float>(it->second.width), static_cast<float>(it->second.height)};
+		}
+
+		/// @brief Submit a recorded command buffer in one pass.
+		///
+		/// Commands are translated into Raylib calls in a single loop without
+		/// per-primitive virtual dispatch; a sorted buffer yields long runs of
+		/// same-kind, same-color primitives for Raylib's internal batching.
+		///
+		/// @param x Command buffer to submit.
+		auto submit(const druid::graphics::CommandBuffer& x) -> void override
+		{
+			for (const auto& command : x.commands())
+			{
+				const ::Color rl_color{.r = command.color.red(), .g = command.color.green(), .b = command.color.blue(), .a = command.color.alpha()};
+
+				switch (command.type)
+				{
+					case druid::graphics::DrawCommand::Type::Rectangle:
+						DrawRectangleRec({.x = command.x, .y = command.y, .width = command.width, .height = command.height}, rl_color);
+						break;
+					case druid::graphics::DrawCommand::Type::Text:
+						// The command buffer's text pool is null-terminated per entry.
+						draw_cached_text(x.text(command), command.x, command.y, command.font_size, rl_color);
+						break;
+					case druid::graphics::DrawCommand::Type::Texture:
+						submit_texture(command.texture, command.source_x, command.source_y, command.source_width, command.source_height, command.x,
+									   command.y, command.width, command.height, command.color);
+						break;
+				}
+			}
+		}
+
+	protected:
 		/// @brief Draw a filled rectangle.
 		///
 		/// @param x X-coordinate of the rectangle origin.
@@ -65,7 +178,7 @@ export namespace druid::raylib
 		/// @param width Rectangle width.
 		/// @param height Rectangle height.
 		/// @param color Fill color.
-		auto draw_rectangle(float x, float y, float width, float height, druid::graphics::Color color) -> void override
+		auto submit_rectangle(float x, float y, float width, float height, druid::graphics::Color color) -> void override
 		{
 			const ::Color rl_color{.r = color.red(), .g = color.green(), .b = color.blue(), .a = color.alpha()};
 
@@ -78,14 +191,168 @@ export namespace druid::raylib
 		///
 		/// @param x X-coordinate of the text origin.
 		/// @param y Y-coordinate of the text origin.
-		/// @param text UTF-8 text string to render.
+		/// @param text UTF-8 text string to render. The view's data is null-terminated.
 		/// @param font_size Font size in pixels.
 		/// @param color Text color.
-		auto draw_text(float x, float y, const std::string& text, int font_size, druid::graphics::Color color) -> void override
+		auto submit_text(float x, float y, std::string_view text, int font_size, druid::graphics::Color color) -> void override
 		{
 			const ::Color rl_color{.r = color.red(), .g = color.green(), .b = color.blue(), .a = color.alpha()};
 
-			DrawText(text.c_str(), static_cast<int>(x), static_cast<int>(y), font_size, rl_color);
+			draw_cached_text(text, x, y, font_size, rl_color);
+		}
+
+		/// @brief Draw a textured quad from a texture sub-rectangle.
+		///
+		/// Raylib batches consecutive draws from the same texture internally,
+		/// so a sorted command buffer turns same-atlas sprite runs into few
+		/// GPU state changes.
+		///
+		/// @param texture Texture to sample.
+		/// @param source_x Sub-rectangle top-left X in texture pixels.
+		/// @param source_y Sub-rectangle top-left Y in texture pixels.
+		/// @param source_width Sub-rectangle width in texture pixels.
+		/// @param source_height Sub-rectangle height in texture pixels.
+		/// @param x X-coordinate of the quad origin.
+		/// @param y Y-coordinate of the quad origin.
+		/// @param width Width of the drawn quad.
+		/// @param height Height of the drawn quad.
+		/// @param tint Tint color multiplied with the texture.
+		auto submit_texture(druid::graphics::TextureHandle texture, float source_x, float source_y, float source_width, float source_height, float x,
+							float y, float width, float height, druid::graphics::Color tint) -> void override
+		{
+			const auto it = textures_.find(texture);
+
+			if (it == textures_.end())
+			{
+				return;
+			}
+
+			const ::Color rl_color{.r = tint.red(), .g = tint.green(), .b = tint.blue(), .a = tint.alpha()};
+			const Rectangle source{.x = source_x, .y = source_y, .width = source_width, .height = source_height};
+			const Rectangle dest{.x = x, .y = y, .width = width, .height = height};
+
+			DrawTexturePro(it->second, source, dest, {.x = 0.0F, .y = 0.0F}, 0.0F, rl_color);
 		}
+
+	private:
+		/// @brief One laid-out string: a texture rasterized once, redrawn as a quad.
+		struct TextEntry
+		{
+			RenderTexture2D texture{};
+			std::uint64_t last_used{};
+		};
+
+		/// @brief Cache key: the string plus the font size it was laid out at.
+		struct TextKey
+		{
+			std::string text;
+			int font_size{};
+
+			[[nodiscard]] auto operator==(const TextKey&) const -> bool = default;
+		};
+
+		/// @brief Transparent view key so lookups avoid copying the string.
+		struct TextKeyView
+		{
+			std::string_view text;
+			int font_size{};
+		};
+
+		/// @brief Transparent hash over (text, font size).
+		struct TextKeyHash
+		{
+			using is_transparent = void;
+
+			[[nodiscard]] auto operator()(const TextKey& x) const noexcept -> std::size_t
+			{
+				return std::hash<std::string_view>{}(x.text) ^ (std::hash<int>{}(x.font_size) << 1U);
+			}
+
+			[[nodiscard]] auto operator()(const TextKeyView& x) const noexcept -> std::size_t
+			{
+				return std::hash<std::string_view>{}(x.text) ^ (std::hash<int>{}(x.font_size) << 1U);
+			}
+		};
+
+		/// @brief Transparent equality matching the transparent hash.
+		struct TextKeyEqual
+		{
+			using is_transparent = void;
+
+			template <typename A, typename B>
+			[[nodiscard]] auto operator()(const A& a, const B& b) const noexcept -> bool
+			{
+				return a.text == b.text && a.font_size == b.font_size;
+			}
+		};
+
+		/// @brief Draw a string through the texture cache.
+		///
+		/// The first draw of a (text, font size) pair lays the string out into
+		/// a render texture; subsequent frames reuse it as a single tinted
+		/// quad, so static HUD labels cost one texture draw instead of a full
+		/// re-shape and re-rasterize per frame. Rasterizing in white keeps one
+		/// texture valid for every tint.
+		///
+		/// @param text UTF-8 text string; the view's data must be null-terminated.
+		/// @param x X-coordinate of the text origin.
+		/// @param y Y-coordinate of the text origin.
+		/// @param font_size Font size in pixels.
+		/// @param tint Text color applied as the quad tint.
+		auto draw_cached_text(std::string_view text, float x, float y, int font_size, ::Color tint) -> void
+		{
+			auto it = text_cache_.find(TextKeyView{.text = text, .font_size = font_size});
+
+			if (it == text_cache_.end())
+			{
+				const auto width = std::max(MeasureText(text.data(), font_size), 1);
+				const auto height = std::max(font_size, 1);
+
+				TextEntry entry{.texture = LoadRenderTexture(width, height)};
+
+				BeginTextureMode(entry.texture);
+				ClearBackground(BLANK);
+				DrawText(text.data(), 0, 0, font_size, WHITE);
+				EndTextureMode();
+
+				it = text_cache_.emplace(TextKey{.text = std::string{text}, .font_size = font_size}, entry).first;
+			}
+
+			it->second.last_used = frame_;
+
+			const auto& texture = it->second.texture.texture;
+			// Render textures are sampled with a negative source height: raylib
+			// stores them bottom-up.
+			const Rectangle source{.x = 0.0F, .y = 0.0F, .width = static_cast<float>(texture.width), .height = -static_cast<float>(texture.height)};
+			DrawTextureRec(texture, source, {.x = x, .y = y}, tint);
+		}
+
+		/// @brief Drop the least recently used entries once the cache overflows.
+		///
+		/// Runs at end of frame, outside the drawing context. Transient strings
+		/// (e.g. a score counter) age out instead of accumulating textures.
+		auto prune_text_cache() -> void
+		{
+			while (text_cache_.size() > TextCacheCapacity)
+			{
+				auto oldest = text_cache_.begin();
+
+				for (auto it = text_cache_.begin(); it != text_cache_.end(); ++it)
+				{
+					if (it->second.last_used < oldest->second.last_used)
+					{
+						oldest = it;
+					}
+				}
+
+				UnloadRenderTexture(oldest->second.texture);
+				text_cache_.erase(oldest);
+			}
+		}
+
+		std::unordered_map<TextKey, TextEntry, TextKeyHash, TextKeyEqual> text_cache_;
+		std::unordered_map<druid::graphics::TextureHandle, Texture2D> textures_;
+		druid::graphics::TextureHandle next_texture_{1};
+		std::uint64_t frame_{};
 	};
 }
@@ -1,16 +1,13 @@
 module;
 
-#include <chrono>
-
-// Need to define a large max range for magic_enum
-// to support all of the raylib keys.
-// NOLINTNEXTLINE (cppcoreguidelines-macro-usage)
-#define MAGIC_ENUM_RANGE_MIN 0
-
-// NOLINTNEXTLINE (cppcoreguidelines-macro-usage)
-#define MAGIC_ENUM_RANGE_MAX 400
 #include <raylib.h>
-#include <magic_enum/magic_enum.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
 
 export module druid.raylib.Window;
 
@@ -285,6 +282,9 @@ export namespace druid::raylib
 		/// Closes the raylib window and releases all resources.
 		~Window() override
 		{
+			// The renderer owns GPU resources (cached text textures); release
+			// it while the raylib context is still alive.
+			set_renderer(nullptr);
 			CloseWindow();
 		}
 
@@ -313,23 +313,80 @@ export namespace druid::raylib
 				engine().event(e);
 			}
 
-			const auto keys = magic_enum::enum_values<KeyboardKey>();
+			using druid::core::EventKeyboard;
 
-			for (auto key : keys)
+			// Drain raylib's pressed-key queue instead of probing every key;
+			// a frame where nothing happened costs zero key queries.
+			for (auto key = GetKeyPressed(); key != 0; key = GetKeyPressed())
 			{
-				using druid::core::EventKeyboard;
+				const auto pressed = static_cast<KeyboardKey>(key);
+
+				EventKeyboard e{.type = EventKeyboard::Type::KeyPressed, .key = ConvertRayLibKey(pressed)};
+				engine().event(e);
 
-				if (IsKeyPressed(key))
+				if (!std::ranges::contains(keys_down_, pressed))
 				{
-					EventKeyboard e{.type = EventKeyboard::Type::KeyPressed, .key = ConvertRayLibKey(key)};
+					keys_down_.push_back(pressed);
+				}
+			}
+
+			// Releases are derived from the (few) currently-held keys only.
+			for (std::size_t i = 0; i < keys_down_.size();)
+			{
+				if (IsKeyUp(keys_down_[i]))
+				{
+					EventKeyboard e{.type = EventKeyboard::Type::KeyReleased, .key = ConvertRayLibKey(keys_down_[i])};
 					engine().event(e);
+
+					keys_down_[i] = keys_down_.back();
+					keys_down_.pop_back();
 				}
-				else if (IsKeyReleased(key))
+				else
 				{
-					EventKeyboard e{.type = EventKeyboard::Type::KeyReleased, .key = ConvertRayLibKey(key)};
+					i++;
+				}
+			}
+
+			using druid::core::EventMouse;
+
+			const auto mouse = GetMousePosition();
+
+			static constexpr std::array Buttons{std::pair{MOUSE_BUTTON_LEFT, EventMouse::Button::Left}, std::pair{MOUSE_BUTTON_RIGHT, EventMouse::Button::Right},
+												std::pair{MOUSE_BUTTON_MIDDLE, EventMouse::Button::Middle}};
+
+			for (const auto& [raylib_button, button] : Buttons)
+			{
+				if (IsMouseButtonPressed(raylib_button))
+				{
+					EventMouse e{.type = EventMouse::Type::ButtonPressed, .button = button, .x = mouse.x, .y = mouse.y};
 					engine().event(e);
 				}
+				else if (IsMouseButtonReleased(raylib_button))
+				{
+					EventMouse e{.type = EventMouse::Type::ButtonReleased, .button = button, .x = mouse.x, .y = mouse.y};
+					engine().event(e);
+				}
+			}
+
+			const auto delta = GetMouseDelta();
+
+			if (delta.x != 0.0F || delta.y != 0.0F)
+			{
+				EventMouse e{.type = EventMouse::Type::Moved, .x = mouse.x, .y = mouse.y};
+				engine().event(e);
 			}
+
+			// A resize or restore invalidates the presented frame even when
+			// no node changed; without this the damage-skipping path keeps
+			// re-presenting the stale pre-resize frame.
+			const auto minimized = IsWindowMinimized();
+
+			if (IsWindowResized() || (minimized_ && !minimized))
+			{
+				request_redraw();
+			}
+
+			minimized_ = minimized;
 		}
 
 		/// @brief End-of-frame hook.
@@ -337,18 +394,36 @@ export namespace druid::raylib
 		/// Renders the scene graph using the raylib renderer.
 		auto update_end() -> void override
 		{
-			// Render the scene
+			// Render the scene, culling subtrees outside the window.
 			if (auto* renderer = get_renderer())
 			{
+				if (!consume_redraw())
+				{
+					// Nothing changed: re-present the previous frame. The
+					// empty begin/end pair keeps raylib's buffer swap and
+					// input polling running without traversing the scene.
+					BeginDrawing();
+					EndDrawing();
+					return;
+				}
+
+				// The window is resizable, so query the live size rather than
+				// the creation-time members — culling against a stale size
+				// would clip content revealed by enlarging the window.
+				const druid::graphics::Bounds viewport{.min = {0.0F, 0.0F},
+													   .max = {static_cast<float>(GetScreenWidth()), static_cast<float>(GetScreenHeight())}};
+
 				renderer->begin(druid::graphics::Color::Black);
-				root_node().draw(*renderer);
+				root_node().draw(*renderer, viewport);
 				renderer->end();
 			}
 		}
 
 	private:
 		std::string last_title_{DefaultTitle};
+		std::vector<KeyboardKey> keys_down_;
 		int width_{DefaultWidth};
 		int height_{DefaultHeight};
+		bool minimized_{false};
 	};
 }